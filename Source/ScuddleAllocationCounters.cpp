@@ -0,0 +1,390 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleAllocationCounters.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The function definitions for counting memory allocations.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleAllocationCounters.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#if defined(__APPLE__)
+# include <malloc/malloc.h>
+#else // ! defined(__APPLE__)
+# include <malloc.h>
+#endif // ! defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The function definitions for counting memory allocations.
+ 
+ The global operator new and operator delete are replaced, so that every allocation made with
+ them is seen; while accounting is not active, the replacements only test a counter. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of callers that have started accounting and not stopped it. */
+static std::atomic<int> lAccountingUsers(0);
+
+/*! @brief The number of blocks allocated while accounting was active. */
+static std::atomic<uint64_t> lAllocations(0);
+
+/*! @brief The number of blocks released while accounting was active. */
+static std::atomic<uint64_t> lReleases(0);
+
+/*! @brief The number of bytes allocated while accounting was active. */
+static std::atomic<uint64_t> lAllocatedBytes(0);
+
+/*! @brief The number of bytes allocated less the number released while accounting was active. */
+static std::atomic<int64_t> lNetBytes(0);
+
+/*! @brief The highest value of lNetBytes since the peak was last reset. */
+static std::atomic<int64_t> lPeakNetBytes(0);
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the size of a block obtained from malloc.
+ @param block The block of interest.
+ @returns The number of usable bytes in the block. */
+static size_t
+blockSize(void * block)
+{
+#if defined(__APPLE__)
+    return malloc_size(block);
+#elif defined(__linux__)
+    return malloc_usable_size(block);
+#else // ! defined(__linux__)
+    return _msize(block);
+#endif // ! defined(__linux__)
+} // blockSize
+
+/*! @brief Return @c true if allocations are being counted.
+ @returns @c true if allocations are being counted. */
+static inline bool
+isAccounting(void)
+{
+    return (0 < lAccountingUsers.load(std::memory_order_relaxed));
+} // isAccounting
+
+/*! @brief Count a block that was allocated.
+ @param numBytes The size of the block, in bytes. */
+static void
+countAllocation(const size_t numBytes)
+{
+    int64_t netBytes = (lNetBytes.fetch_add(static_cast<int64_t>(numBytes),
+                                            std::memory_order_relaxed) +
+                        static_cast<int64_t>(numBytes));
+    int64_t peakNetBytes = lPeakNetBytes.load(std::memory_order_relaxed);
+    
+    lAllocations.fetch_add(1, std::memory_order_relaxed);
+    lAllocatedBytes.fetch_add(numBytes, std::memory_order_relaxed);
+    while ((peakNetBytes < netBytes) &&
+           (! lPeakNetBytes.compare_exchange_weak(peakNetBytes, netBytes,
+                                                  std::memory_order_relaxed)))
+    {
+    }
+} // countAllocation
+
+/*! @brief Count a block that was released.
+ @param numBytes The size of the block, in bytes. */
+static void
+countRelease(const size_t numBytes)
+{
+    lReleases.fetch_add(1, std::memory_order_relaxed);
+    lNetBytes.fetch_sub(static_cast<int64_t>(numBytes), std::memory_order_relaxed);
+} // countRelease
+
+/*! @brief Allocate a block of memory for operator new.
+ @param numBytes The size of the block, in bytes.
+ @returns The block, which is never @c nullptr. */
+static void *
+allocateBlock(const size_t numBytes)
+{
+    void * result = malloc(numBytes ? numBytes : 1);
+    
+    while (! result)
+    {
+        std::new_handler handler = std::get_new_handler();
+        
+        if (! handler)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+        result = malloc(numBytes ? numBytes : 1);
+    }
+    if (isAccounting())
+    {
+        countAllocation(blockSize(result));
+    }
+    return result;
+} // allocateBlock
+
+/*! @brief Release a block of memory for operator delete.
+ @param block The block to be released. */
+static void
+releaseBlock(void * block)
+{
+    if (block)
+    {
+        if (isAccounting())
+        {
+            countRelease(blockSize(block));
+        }
+        free(block);
+    }
+} // releaseBlock
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+void *
+operator new(std::size_t numBytes)
+{
+    return allocateBlock(numBytes);
+} // operator new
+
+void *
+operator new(std::size_t             numBytes,
+             const std::nothrow_t & )
+noexcept
+{
+    void * result;
+    
+    try
+    {
+        result = allocateBlock(numBytes);
+    }
+    catch (...)
+    {
+        result = nullptr;
+    }
+    return result;
+} // operator new
+
+void *
+operator new[](std::size_t numBytes)
+{
+    return allocateBlock(numBytes);
+} // operator new[]
+
+void *
+operator new[](std::size_t             numBytes,
+               const std::nothrow_t & )
+noexcept
+{
+    return operator new(numBytes, std::nothrow);
+} // operator new[]
+
+void
+operator delete(void * block)
+noexcept
+{
+    releaseBlock(block);
+} // operator delete
+
+#if defined(__cpp_sized_deallocation)
+void
+operator delete(void *      block,
+                std::size_t )
+noexcept
+{
+    releaseBlock(block);
+} // operator delete
+#endif // defined(__cpp_sized_deallocation)
+
+void
+operator delete(void *                 block,
+                const std::nothrow_t & )
+noexcept
+{
+    releaseBlock(block);
+} // operator delete
+
+void
+operator delete[](void * block)
+noexcept
+{
+    releaseBlock(block);
+} // operator delete[]
+
+#if defined(__cpp_sized_deallocation)
+void
+operator delete[](void *      block,
+                  std::size_t )
+noexcept
+{
+    releaseBlock(block);
+} // operator delete[]
+#endif // defined(__cpp_sized_deallocation)
+
+void
+operator delete[](void *                 block,
+                  const std::nothrow_t & )
+noexcept
+{
+    releaseBlock(block);
+} // operator delete[]
+
+void
+Scuddle::ReadAllocationCounts(AllocationCounts & counts)
+{
+    counts.allocations = lAllocations.load(std::memory_order_relaxed);
+    counts.releases = lReleases.load(std::memory_order_relaxed);
+    counts.allocatedBytes = lAllocatedBytes.load(std::memory_order_relaxed);
+    counts.netBytes = lNetBytes.load(std::memory_order_relaxed);
+    counts.peakNetBytes = lPeakNetBytes.load(std::memory_order_relaxed);
+} // Scuddle::ReadAllocationCounts
+
+void
+Scuddle::RecordAllocation(const size_t numBytes)
+{
+    if (isAccounting())
+    {
+        countAllocation(numBytes);
+    }
+} // Scuddle::RecordAllocation
+
+void
+Scuddle::RecordBlockAllocation(void * block)
+{
+    if (block && isAccounting())
+    {
+        countAllocation(blockSize(block));
+    }
+} // Scuddle::RecordBlockAllocation
+
+void
+Scuddle::RecordBlockRelease(void * block)
+{
+    if (block && isAccounting())
+    {
+        countRelease(blockSize(block));
+    }
+} // Scuddle::RecordBlockRelease
+
+void
+Scuddle::RecordRelease(const size_t numBytes)
+{
+    if (isAccounting())
+    {
+        countRelease(numBytes);
+    }
+} // Scuddle::RecordRelease
+
+void
+Scuddle::ReportAllocationSamples(std::ostream &                 outStream,
+                                 const AllocationSampleVector & samples)
+{
+    for (AllocationSampleVector::const_iterator walker(samples.begin()); samples.end() != walker;
+         ++walker)
+    {
+        if (walker->finalSelection)
+        {
+            outStream << "Final selection:" << std::endl;
+        }
+        else
+        {
+            outStream << "Generation " << (walker->generation + 1) << ":" << std::endl;
+        }
+        for (size_t ii = 0; kNumEnginePhases > ii; ++ii)
+        {
+            const AllocationCounts & counts = walker->phases[ii];
+            EnginePhase              phase = static_cast<EnginePhase>(ii);
+            
+            if (IsPhaseInSample(phase, walker->finalSelection, walker->statistics))
+            {
+                outStream << "  " << GetEnginePhaseName(phase) << ": allocations " <<
+                            counts.allocations << " (" << counts.allocatedBytes <<
+                            " bytes) releases " << counts.releases << " net " << counts.netBytes <<
+                            " bytes peak " << counts.peakNetBytes << " bytes" << std::endl;
+            }
+        }
+    }
+} // Scuddle::ReportAllocationSamples
+
+void
+Scuddle::ResetAllocationPeak(void)
+{
+    lPeakNetBytes.store(lNetBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+} // Scuddle::ResetAllocationPeak
+
+void
+Scuddle::StartAllocationAccounting(void)
+{
+    ++lAccountingUsers;
+} // Scuddle::StartAllocationAccounting
+
+void
+Scuddle::StopAllocationAccounting(void)
+{
+    --lAccountingUsers;
+} // Scuddle::StopAllocationAccounting
@@ -0,0 +1,163 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleAllocationCounters.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The function declarations for counting memory allocations.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_AllocationCounters_H_))
+# define Scuddle_AllocationCounters_H_ /* Header guard */
+
+# include "ScuddlePhaseStatistics.h"
+
+# include <array>
+# include <cstdint>
+# include <ostream>
+# include <vector>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The function declarations for counting memory allocations. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief The memory allocations made while accounting was active, or the changes in them
+     over a phase. */
+    struct AllocationCounts
+    {
+        /*! @brief The number of blocks allocated. */
+        uint64_t allocations;
+        
+        /*! @brief The number of blocks released. */
+        uint64_t releases;
+        
+        /*! @brief The number of bytes allocated. */
+        uint64_t allocatedBytes;
+        
+        /*! @brief The number of bytes allocated less the number of bytes released. */
+        int64_t netBytes;
+        
+        /*! @brief The highest value of netBytes since the peak was last reset; for a phase, the
+         highest rise in netBytes during the phase. */
+        int64_t peakNetBytes;
+        
+    }; // AllocationCounts
+    
+    /*! @brief The memory allocations made during each phase of a generation. */
+    struct AllocationSample
+    {
+        /*! @brief The number of generations that had been produced when the sample was taken. */
+        size_t generation;
+        
+        /*! @brief @c true if the sample covers the final selections rather than a generation. */
+        bool finalSelection;
+        
+        /*! @brief @c true if the population was summarized during the generation. */
+        bool statistics;
+        
+        /*! @brief The allocations made during each phase; the generation phase holds the totals
+         over the other phases. */
+        std::array<AllocationCounts, kNumEnginePhases> phases;
+        
+    }; // AllocationSample
+    
+    /*! @brief A sequence of samples of the memory allocations. */
+    typedef std::vector<AllocationSample> AllocationSampleVector;
+    
+    /*! @brief Return the memory allocations made while accounting was active.
+     
+     The counts cover the whole process; allocations made by other engines or threads at the same
+     time are included.
+     @param counts Set to the allocations made while accounting was active. */
+    void
+    ReadAllocationCounts(AllocationCounts & counts);
+    
+    /*! @brief Record a block of memory that was obtained without operator new, if accounting is
+     active.
+     @param numBytes The size of the block, in bytes. */
+    void
+    RecordAllocation(const size_t numBytes);
+    
+    /*! @brief Record a block of memory that was obtained directly from malloc or posix_memalign,
+     if accounting is active.
+     @param block The block that was allocated. */
+    void
+    RecordBlockAllocation(void * block);
+    
+    /*! @brief Record the release of a block of memory that was obtained directly from malloc or
+     posix_memalign, if accounting is active.
+     @param block The block that is about to be released. */
+    void
+    RecordBlockRelease(void * block);
+    
+    /*! @brief Record the release of a block of memory that was obtained without operator new, if
+     accounting is active.
+     @param numBytes The size of the block, in bytes. */
+    void
+    RecordRelease(const size_t numBytes);
+    
+    /*! @brief Print out the allocations made during each phase of each sample.
+     @param outStream The stream to write to.
+     @param samples The samples to be printed. */
+    void
+    ReportAllocationSamples(std::ostream &                 outStream,
+                            const AllocationSampleVector & samples);
+    
+    /*! @brief Restart the peak of the net number of bytes allocated from the current value. */
+    void
+    ResetAllocationPeak(void);
+    
+    /*! @brief Start counting memory allocations.
+     
+     Allocations are counted while at least one caller has started accounting and not stopped
+     it. Blocks that were allocated before accounting started are counted when released, so the
+     net number of bytes can be negative. */
+    void
+    StartAllocationAccounting(void);
+    
+    /*! @brief Stop counting memory allocations, for one caller of StartAllocationAccounting. */
+    void
+    StopAllocationAccounting(void);
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_AllocationCounters_H_) */
@@ -0,0 +1,265 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleBatchEvolver.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for BatchEvolver objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleBatchEvolver.h"
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for BatchEvolver objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+template <typename CrossoverPolicy>
+BatchEvolver<CrossoverPolicy>::BatchEvolver(void) :
+    inherited()
+{
+} // BatchEvolver::BatchEvolver
+
+template <typename CrossoverPolicy>
+BatchEvolver<CrossoverPolicy>::BatchEvolver(const uint64_t seed) :
+    inherited(seed)
+{
+} // BatchEvolver::BatchEvolver
+
+template <typename CrossoverPolicy>
+BatchEvolver<CrossoverPolicy>::~BatchEvolver(void)
+{
+} // BatchEvolver::~BatchEvolver
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::calculateFitnessValues(void)
+{
+    FitnessCoefficients coefficients;
+    
+    fitnessProfile.getCoefficients(coefficients);
+    // The coefficients are referred to rather than copied, as forEachRange returns only when
+    // every range is done; this keeps the task small enough to be held without a heap allocation.
+    forEachRange(_population.size(), [this, &coefficients] (const size_t first,
+                                                            const size_t last)
+                 {
+                     _population.updateFitness(coefficients, first, last);
+                 });
+    // The batch has no record of which poses have changed, so every pose is evaluated.
+    recordEvaluations(_population.size(), 0);
+} // BatchEvolver::calculateFitnessValues
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::collectStatistics(PopulationStatistics & statistics)
+{
+    size_t numPoses = _population.size();
+    
+    // The fitness values and the angles are added a column at a time; the classifications are
+    // not stored, so each pose is classified again.
+    statistics.addScores(_population.getScoreColumn(), numPoses);
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        statistics.addAngles(ii, _population.getAngleColumn(ii), numPoses);
+    }
+    for (size_t ii = 0; numPoses > ii; ++ii)
+    {
+        statistics.addFactors(_population.getFitnessFactors(ii));
+    }
+} // BatchEvolver::collectStatistics
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::doCrossovers(void)
+{
+    // The selected parents are carried forward into the next generation, and we create two new
+    // 'children' for each parent pair directly after them; then the generations are exchanged,
+    // so that the storage of the previous generation is reused for the one after.
+    size_t numSwap = CrossoverPolicy::getSwapCount(*this, Skeleton::kNumAttributes);
+    
+    _nextPopulation.clear();
+    for (PoseIndexVector::const_iterator walker(_selection.begin()); _selection.end() != walker;
+         ++walker)
+    {
+        _nextPopulation.append(_population, *walker);
+    }
+    for (size_t targetSize = populationSize.getValue(); targetSize > _nextPopulation.size(); )
+    {
+        // Pick two 'parent' poses:
+        size_t popSize = _nextPopulation.size();
+        size_t firstChoice = randUnsignedInRange(popSize - 1);
+        size_t secondChoice;
+        
+        for ( ; ; )
+        {
+            secondChoice = randUnsignedInRange(popSize - 1);
+            if (firstChoice != secondChoice)
+            {
+                break;
+            }
+            
+        }
+        // Crossover attributes:
+        _nextPopulation.append(_nextPopulation, firstChoice);
+        _nextPopulation.append(_nextPopulation, secondChoice);
+        _nextPopulation.swapValues(popSize, popSize + 1, numSwap, getGenerator());
+    }
+    _population.swap(_nextPopulation);
+    // The parents are now at the start of the population.
+    for (size_t ii = 0, imax = _selection.size(); imax > ii; ++ii)
+    {
+        _selection[ii] = ii;
+    }
+} // BatchEvolver::doCrossovers
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::doMutations(void)
+{
+    // Mark the poses to be mutated:
+    for (size_t ii = 0, jmax = _population.size(),
+         imax = static_cast<size_t>(mutationFraction.getValue() * jmax); imax > ii; )
+    {
+        size_t jj = randUnsignedInRange(jmax - 1);
+        
+        if (! _population.isMarked(jj))
+        {
+            _population.setMark(jj);
+            ++ii;
+        }
+    }
+    for (size_t ii = 0, imax = _population.size(); imax > ii; ++ii)
+    {
+        if (_population.isMarked(ii))
+        {
+            _population.mutate(ii, getGenerator());
+            _population.clearMark(ii);
+        }
+    }
+} // BatchEvolver::doMutations
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::init(void)
+{
+    size_t numPoses = populationSize.getValue();
+    
+    _selection.clear();
+    _population.clear();
+    // Leave room for the extra child when the population size is odd.
+    _population.reserve(numPoses + 1);
+    _nextPopulation.clear();
+    _nextPopulation.reserve(numPoses + 1);
+    _population.resize(numPoses);
+    _population.randomizeAll(getGenerator());
+    resetGeneration();
+} // BatchEvolver::init
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::makeFinalSelection(const size_t selectionSize)
+{
+    _wheel.build(_population.getScoreColumn(), _population.size());
+    _wheel.pickUniversal(selectionSize, getGenerator(), _selection);
+} // BatchEvolver::makeFinalSelection
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::makeSelection(void)
+{
+    _wheel.build(_population.getScoreColumn(), _population.size());
+    _wheel.pickWithoutReplacement(getParentCount(_population.size()), getGenerator(), _selection);
+} // BatchEvolver::makeSelection
+
+template <typename CrossoverPolicy>
+void
+BatchEvolver<CrossoverPolicy>::rescoreFitnessValues(void)
+{
+    // The batch does not keep the fitness factors of the poses, so the scores are calculated
+    // again; the kernels are fast enough that this is not worth the extra columns.
+    FitnessCoefficients coefficients;
+    
+    fitnessProfile.getCoefficients(coefficients);
+    forEachRange(_population.size(), [this, &coefficients] (const size_t first,
+                                                            const size_t last)
+                 {
+                     _population.updateFitness(coefficients, first, last);
+                 });
+} // BatchEvolver::rescoreFitnessValues
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Template instantiations
+#endif // defined(__APPLE__)
+
+template class Scuddle::BatchEvolver<CrossoverByCount>;
+template class Scuddle::BatchEvolver<CrossoverByFraction>;
@@ -0,0 +1,174 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleBatchEvolver.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for BatchEvolver objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_BatchEvolver_H_))
+# define Scuddle_BatchEvolver_H_ /* Header guard */
+
+# include "ScuddleCrossoverPolicies.h"
+# include "ScuddleEvolverBase.h"
+# include "ScuddlePoseBatch.h"
+# include "ScuddleRouletteWheel.h"
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for BatchEvolver objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief A sequence of indices of poses within a PoseBatch. */
+    typedef std::vector<size_t> PoseIndexVector;
+    
+    /*! @brief The Scuddle BatchEvolver engine, which works on a set of Skeleton poses that are
+     stored column-wise.
+     
+     @c CrossoverPolicy, either CrossoverByCount or CrossoverByFraction, gives the number of
+     attributes to swap; both are instantiated in ScuddleBatchEvolver.cpp. */
+    template <typename CrossoverPolicy>
+    class BatchEvolver : public EvolverBase
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The random number generator is seeded from the system entropy source. */
+        BatchEvolver(void);
+        
+        /*! @brief The constructor.
+         @param seed The seed for the random number generator. */
+        explicit
+        BatchEvolver(const uint64_t seed);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~BatchEvolver(void);
+        
+        /*! @brief Return the current set of poses.
+         @returns The current set of poses. */
+        const PoseBatch &
+        getPopulation(void)
+        const
+        {
+            return _population;
+        } // getPopulation
+        
+        /*! @brief Return the indices, within the current set of poses, of the most recently
+         selected poses.
+         @returns The indices of the most recently selected poses. */
+        const PoseIndexVector &
+        getSelection(void)
+        const
+        {
+            return _selection;
+        } // getSelection
+        
+        /*! @brief Discard any existing poses and create a new population. */
+        virtual void
+        init(void);
+        
+    protected :
+        
+        /*! @brief Update the fitness value for the poses. */
+        virtual void
+        calculateFitnessValues(void);
+        
+        /*! @brief Add each of the poses to a summary of the population.
+         @param statistics The summary to be added to. */
+        virtual void
+        collectStatistics(PopulationStatistics & statistics);
+        
+        /*! @brief Generate a new set of poses, using the selected parents. */
+        virtual void
+        doCrossovers(void);
+        
+        /*! @brief Mutate some of the poses. */
+        virtual void
+        doMutations(void);
+        
+        /*! @brief Make the final selections.
+         @param selectionSize The number of poses to be selected. */
+        virtual void
+        makeFinalSelection(const size_t selectionSize);
+        
+        /*! @brief Make the selections for this iteration. */
+        virtual void
+        makeSelection(void);
+        
+        /*! @brief Apply the current fitness coefficients to the poses. */
+        virtual void
+        rescoreFitnessValues(void);
+        
+    private :
+        
+        /*! @brief The class that this class is derived from. */
+        typedef EvolverBase inherited;
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The set of poses that are worked on. */
+        PoseBatch _population;
+        
+        /*! @brief The storage for the next generation, which is exchanged with the current
+         generation after the crossovers. */
+        PoseBatch _nextPopulation;
+        
+        /*! @brief The indices of the poses that have been selected. */
+        PoseIndexVector _selection;
+        
+        /*! @brief The roulette wheel used to make selections. */
+        RouletteWheel _wheel;
+        
+    }; // BatchEvolver
+    
+    extern template class BatchEvolver<CrossoverByCount>;
+    extern template class BatchEvolver<CrossoverByFraction>;
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_BatchEvolver_H_) */
@@ -0,0 +1,614 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleBenchmark.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The benchmarks for the hot paths of the Scuddle evolution engines.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "ScuddleAllocationCounters.h"
+#include "ScuddleBody.h"
+#include "ScuddleCrossoverPolicies.h"
+#include "ScuddleEvolver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The benchmarks for the hot paths of the Scuddle evolution engines. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The formats in which the results can be written. */
+enum OutputFormat
+{
+    /*! @brief One line of comma-separated values per result, after a header line. */
+    kOutputCSV,
+    
+    /*! @brief An array of JSON objects, one per result. */
+    kOutputJSON
+    
+}; // OutputFormat
+
+/*! @brief The timings of one benchmark at one population size. */
+struct BenchmarkResult
+{
+    /*! @brief The name of the benchmark. */
+    std::string _name;
+    
+    /*! @brief The number of objects processed by each run. */
+    size_t _populationSize;
+    
+    /*! @brief The number of runs that were timed. */
+    size_t _numRepeats;
+    
+    /*! @brief The shortest run, in nanoseconds. */
+    double _minimum;
+    
+    /*! @brief The median run, in nanoseconds. */
+    double _median;
+    
+    /*! @brief The mean run, in nanoseconds. */
+    double _mean;
+    
+    /*! @brief The mean number of memory allocations made by a run. */
+    double _allocations;
+    
+    /*! @brief The mean number of bytes allocated by a run. */
+    double _allocatedBytes;
+    
+}; // BenchmarkResult
+
+/*! @brief A sequence of benchmark results. */
+typedef std::vector<BenchmarkResult> ResultVector;
+
+/*! @brief A sequence of run times, in nanoseconds. */
+typedef std::vector<double> TimeVector;
+
+/*! @brief An action to be run before each timed run, or that is timed. */
+typedef std::function<void(void)> BenchmarkAction;
+
+/*! @brief An engine that exposes the phases of a generation, so that each can be timed. */
+template <typename Genome>
+class PhaseEvolver : public Evolver<Genome, CrossoverByCount>
+{
+public :
+    
+    /*! @brief The constructor.
+     @param seed The seed for the random number generator. */
+    explicit
+    PhaseEvolver(const uint64_t seed) :
+        Evolver<Genome, CrossoverByCount>(seed)
+    {
+    } // PhaseEvolver
+    
+    using Evolver<Genome, CrossoverByCount>::calculateFitnessValues;
+    
+    using Evolver<Genome, CrossoverByCount>::doCrossovers;
+    
+    using Evolver<Genome, CrossoverByCount>::doMutations;
+    
+    using Evolver<Genome, CrossoverByCount>::makeSelection;
+    
+}; // PhaseEvolver
+
+/*! @brief The default number of runs of each benchmark that are timed. */
+static const size_t kDefaultRepeats = 10;
+
+/*! @brief The default number of untimed runs of each benchmark, made before the timed runs. */
+static const size_t kDefaultWarmups = 2;
+
+/*! @brief The default largest population size. */
+static const size_t kDefaultMaximumSize = 10000000;
+
+/*! @brief The population sizes that are swept. */
+static const size_t kPopulationSizes[] =
+{
+    200, 1000, 10000, 100000, 1000000, 10000000
+};
+
+/*! @brief The seed for all the random number generators, so that every run does the same work
+ ('Scuddle'). */
+static const uint64_t kSeed = 0x53637564646C65;
+
+/*! @brief Receives values computed by the benchmarks, so that the work is not optimized away. */
+static volatile double lSink = 0;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add the memory allocations made since a given point to a running total.
+ @param startCounts The allocation counts at the start of the interval.
+ @param totals The running total of allocations and allocated bytes. */
+static void
+addAllocationsSince(const AllocationCounts & startCounts,
+                    AllocationCounts &       totals)
+{
+    AllocationCounts finishCounts;
+    
+    ReadAllocationCounts(finishCounts);
+    totals.allocations += (finishCounts.allocations - startCounts.allocations);
+    totals.allocatedBytes += (finishCounts.allocatedBytes - startCounts.allocatedBytes);
+} // addAllocationsSince
+
+/*! @brief Add the summary of a set of run times to the results.
+ @param name The name of the benchmark.
+ @param populationSize The number of objects processed by each run.
+ @param times The run times, in nanoseconds.
+ @param allocations The memory allocations made by all the runs.
+ @param results The results to be added to. */
+static void
+addResult(const std::string &      name,
+          const size_t             populationSize,
+          TimeVector               times,
+          const AllocationCounts & allocations,
+          ResultVector &           results)
+{
+    BenchmarkResult aResult;
+    double          total = 0;
+    
+    std::sort(times.begin(), times.end());
+    for (TimeVector::const_iterator walker(times.begin()); times.end() != walker; ++walker)
+    {
+        total += *walker;
+    }
+    aResult._name = name;
+    aResult._populationSize = populationSize;
+    aResult._numRepeats = times.size();
+    aResult._minimum = (times.empty() ? 0 : times.front());
+    aResult._median = (times.empty() ? 0 : times[times.size() / 2]);
+    aResult._mean = (times.empty() ? 0 : (total / times.size()));
+    aResult._allocations = (times.empty() ? 0 :
+                            (static_cast<double>(allocations.allocations) / times.size()));
+    aResult._allocatedBytes = (times.empty() ? 0 :
+                               (static_cast<double>(allocations.allocatedBytes) / times.size()));
+    results.push_back(aResult);
+} // addResult
+
+/*! @brief Return the number of nanoseconds since a given time.
+ @param startTime The time at which the interval started.
+ @returns The number of nanoseconds since the given time. */
+static double
+nanosecondsSince(const std::chrono::steady_clock::time_point & startTime)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() -
+                                                    startTime).count();
+} // nanosecondsSince
+
+/*! @brief Time an action repeatedly, after some untimed warm-up runs.
+ @param name The name of the benchmark.
+ @param populationSize The number of objects processed by each run.
+ @param numWarmups The number of untimed runs.
+ @param numRepeats The number of timed runs.
+ @param prepare The action to run, untimed, before each run.
+ @param action The action to be timed.
+ @param results The results to be added to. */
+static void
+timeAction(const std::string &     name,
+           const size_t            populationSize,
+           const size_t            numWarmups,
+           const size_t            numRepeats,
+           const BenchmarkAction & prepare,
+           const BenchmarkAction & action,
+           ResultVector &          results)
+{
+    TimeVector       times;
+    AllocationCounts allocations = AllocationCounts();
+    AllocationCounts startCounts;
+    
+    for (size_t ii = 0, imax = (numWarmups + numRepeats); imax > ii; ++ii)
+    {
+        prepare();
+        ReadAllocationCounts(startCounts);
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+        
+        action();
+        double elapsed = nanosecondsSince(startTime);
+        
+        if (numWarmups <= ii)
+        {
+            // Count the allocations first, so that growing the run times is not included.
+            addAllocationsSince(startCounts, allocations);
+            times.push_back(elapsed);
+        }
+    }
+    addResult(name, populationSize, times, allocations, results);
+} // timeAction
+
+/*! @brief Time the free functions that are used by the fitness and mutation code.
+ @param populationSize The number of calls in each run.
+ @param numWarmups The number of untimed runs.
+ @param numRepeats The number of timed runs.
+ @param results The results to be added to. */
+static void
+benchmarkFunctions(const size_t   populationSize,
+                   const size_t   numWarmups,
+                   const size_t   numRepeats,
+                   ResultVector & results)
+{
+    RandomGenerator       generator(kSeed);
+    std::vector<realType> angles;
+    
+    angles.reserve(populationSize);
+    for (size_t ii = 0; populationSize > ii; ++ii)
+    {
+        angles.push_back(generator.nextAngle(360));
+    }
+    timeAction("MapAngleToQuadrant", populationSize, numWarmups, numRepeats, [] { },
+               [&angles]
+               {
+                   int sum = 0;
+                   
+                   for (std::vector<realType>::const_iterator walker(angles.begin());
+                        angles.end() != walker; ++walker)
+                   {
+                       sum += MapAngleToQuadrant(*walker, 90, 4, 180, 1, 270, 2, 1);
+                   }
+                   lSink = sum;
+               }, results);
+    timeAction("RandRealInRange", populationSize, numWarmups, numRepeats, [] { },
+               [populationSize]
+               {
+                   realType sum = 0;
+                   
+                   for (size_t ii = 0; populationSize > ii; ++ii)
+                   {
+                       sum += RandRealInRange(0, 1);
+                   }
+                   lSink = sum;
+               }, results);
+} // benchmarkFunctions
+
+/*! @brief Time the operations of a kind of object.
+ 
+ Each run works on a fresh copy of the same population, so that every run does the same work.
+ @param label The name of the kind of object.
+ @param populationSize The number of objects.
+ @param numWarmups The number of untimed runs.
+ @param numRepeats The number of timed runs.
+ @param results The results to be added to. */
+template <typename Genome>
+static void
+benchmarkGenome(const std::string & label,
+                const size_t        populationSize,
+                const size_t        numWarmups,
+                const size_t        numRepeats,
+                ResultVector &      results)
+{
+    std::vector<Genome> original;
+    std::vector<Genome> population;
+    FitnessCoefficients coefficients;
+    RandomGenerator     generator(kSeed);
+    BenchmarkAction     restore = [&]
+                                  {
+                                      population = original;
+                                      generator = RandomGenerator(kSeed);
+                                  };
+    
+    FitnessProfile().getCoefficients(coefficients);
+    original.reserve(populationSize);
+    for (size_t ii = 0; populationSize > ii; ++ii)
+    {
+        RandomGenerator individualGenerator(kSeed, ii);
+        
+        original.emplace_back(individualGenerator);
+    }
+    timeAction(label + "::updateFitness", populationSize, numWarmups, numRepeats, restore,
+               [&]
+               {
+                   for (size_t ii = 0; populationSize > ii; ++ii)
+                   {
+                       population[ii].updateFitness(coefficients);
+                   }
+               }, results);
+    timeAction(label + "::mutate", populationSize, numWarmups, numRepeats, restore,
+               [&]
+               {
+                   for (size_t ii = 0; populationSize > ii; ++ii)
+                   {
+                       population[ii].mutate(generator);
+                   }
+               }, results);
+    timeAction(label + "::swapValues", populationSize, numWarmups, numRepeats, restore,
+               [&]
+               {
+                   for (size_t ii = 1; populationSize > ii; ii += 2)
+                   {
+                       population[ii - 1].swapValues(population[ii], 2, generator);
+                   }
+               }, results);
+} // benchmarkGenome
+
+/*! @brief Time the phases of a generation of an engine.
+ 
+ The fitness values are brought up to date, untimed, before the selection of each run.
+ @param label The name of the kind of object.
+ @param populationSize The number of objects.
+ @param numWarmups The number of untimed runs.
+ @param numRepeats The number of timed runs.
+ @param results The results to be added to. */
+template <typename Genome>
+static void
+benchmarkPhases(const std::string & label,
+                const size_t        populationSize,
+                const size_t        numWarmups,
+                const size_t        numRepeats,
+                ResultVector &      results)
+{
+    PhaseEvolver<Genome> anEvolver(kSeed);
+    TimeVector           selectionTimes;
+    TimeVector           crossoverTimes;
+    TimeVector           mutationTimes;
+    AllocationCounts     selectionAllocations = AllocationCounts();
+    AllocationCounts     crossoverAllocations = AllocationCounts();
+    AllocationCounts     mutationAllocations = AllocationCounts();
+    AllocationCounts     selectionStartCounts;
+    AllocationCounts     crossoverStartCounts;
+    AllocationCounts     mutationStartCounts;
+    
+    anEvolver.populationSize.setValue(populationSize);
+    anEvolver.init();
+    for (size_t ii = 0, imax = (numWarmups + numRepeats); imax > ii; ++ii)
+    {
+        anEvolver.calculateFitnessValues();
+        ReadAllocationCounts(selectionStartCounts);
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+        
+        anEvolver.makeSelection();
+        double selectionTime = nanosecondsSince(startTime);
+        
+        ReadAllocationCounts(crossoverStartCounts);
+        startTime = std::chrono::steady_clock::now();
+        anEvolver.doCrossovers();
+        double crossoverTime = nanosecondsSince(startTime);
+        
+        ReadAllocationCounts(mutationStartCounts);
+        startTime = std::chrono::steady_clock::now();
+        anEvolver.doMutations();
+        double mutationTime = nanosecondsSince(startTime);
+        
+        if (numWarmups <= ii)
+        {
+            addAllocationsSince(mutationStartCounts, mutationAllocations);
+            selectionTimes.push_back(selectionTime);
+            crossoverTimes.push_back(crossoverTime);
+            mutationTimes.push_back(mutationTime);
+            selectionAllocations.allocations += (crossoverStartCounts.allocations -
+                                                 selectionStartCounts.allocations);
+            selectionAllocations.allocatedBytes += (crossoverStartCounts.allocatedBytes -
+                                                    selectionStartCounts.allocatedBytes);
+            crossoverAllocations.allocations += (mutationStartCounts.allocations -
+                                                 crossoverStartCounts.allocations);
+            crossoverAllocations.allocatedBytes += (mutationStartCounts.allocatedBytes -
+                                                    crossoverStartCounts.allocatedBytes);
+        }
+    }
+    addResult(label + "Evolver::makeSelection", populationSize, selectionTimes,
+              selectionAllocations, results);
+    addResult(label + "Evolver::doCrossovers", populationSize, crossoverTimes,
+              crossoverAllocations, results);
+    addResult(label + "Evolver::doMutations", populationSize, mutationTimes, mutationAllocations,
+              results);
+} // benchmarkPhases
+
+/*! @brief Parse a count from an argument of the form 'name=value'.
+ @param text The text after the '='.
+ @param value Set to the count, if the text is valid.
+ @returns @c true if the text is a positive count and @c false otherwise. */
+static bool
+parseCount(const std::string & text,
+           size_t &            value)
+{
+    const char *       start = text.c_str();
+    char *             end = nullptr;
+    unsigned long long parsed = strtoull(start, &end, 10);
+    bool               okSoFar = ((start != end) && ('\0' == *end) && (0 < parsed));
+    
+    if (okSoFar)
+    {
+        value = static_cast<size_t>(parsed);
+    }
+    return okSoFar;
+} // parseCount
+
+/*! @brief Write out the results.
+ @param outStream The stream to write to.
+ @param format The format for the results.
+ @param results The results to be written. */
+static void
+writeResults(std::ostream &       outStream,
+             const OutputFormat   format,
+             const ResultVector & results)
+{
+    outStream << std::fixed << std::setprecision(1);
+    if (kOutputCSV == format)
+    {
+        outStream << "benchmark,population,repeats,min_ns,median_ns,mean_ns,median_ns_per_item," <<
+                    "allocations,allocated_bytes" << std::endl;
+        for (ResultVector::const_iterator walker(results.begin()); results.end() != walker;
+             ++walker)
+        {
+            outStream << walker->_name << "," << walker->_populationSize << "," <<
+                        walker->_numRepeats << "," << walker->_minimum << "," <<
+                        walker->_median << "," << walker->_mean << "," <<
+                        (walker->_median / walker->_populationSize) << "," <<
+                        walker->_allocations << "," << walker->_allocatedBytes << std::endl;
+        }
+    }
+    else
+    {
+        outStream << "[" << std::endl;
+        for (ResultVector::const_iterator walker(results.begin()); results.end() != walker;
+             ++walker)
+        {
+            outStream << "  { \"benchmark\": \"" << walker->_name << "\", \"population\": " <<
+                        walker->_populationSize << ", \"repeats\": " << walker->_numRepeats <<
+                        ", \"min_ns\": " << walker->_minimum << ", \"median_ns\": " <<
+                        walker->_median << ", \"mean_ns\": " << walker->_mean <<
+                        ", \"median_ns_per_item\": " <<
+                        (walker->_median / walker->_populationSize) <<
+                        ", \"allocations\": " << walker->_allocations <<
+                        ", \"allocated_bytes\": " << walker->_allocatedBytes << " }" <<
+                        (((walker + 1) == results.end()) ? "" : ",") << std::endl;
+        }
+        outStream << "]" << std::endl;
+    }
+} // writeResults
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for the benchmarks.
+ 
+ Standard output will receive the results, as JSON (the default) or with the argument 'csv' as
+ comma-separated values. Population sizes from 200 up to 10 million are swept; the argument
+ 'max=' followed by a number limits the largest size. The arguments 'repeats=' and 'warmup='
+ set the number of timed and untimed runs of each benchmark. All random number generators use
+ fixed seeds, so that every run of the application does the same work. The mean number of memory
+ allocations and bytes allocated by a run are reported with each result, so that changes that
+ add allocations to a hot path show up.
+ @param argc The number of arguments in 'argv'.
+ @param argv The arguments to be used with the application.
+ @returns @c 0 on success and @c 1 on failure. */
+int
+main(int            argc,
+     const char * * argv)
+{
+    OutputFormat format = kOutputJSON;
+    size_t       maximumSize = kDefaultMaximumSize;
+    size_t       numRepeats = kDefaultRepeats;
+    size_t       numWarmups = kDefaultWarmups;
+    bool         okSoFar = true;
+    
+    for (int ii = 1; okSoFar && (argc > ii); ++ii)
+    {
+        std::string anArg(argv[ii]);
+        
+        if ("csv" == anArg)
+        {
+            format = kOutputCSV;
+        }
+        else if ("json" == anArg)
+        {
+            format = kOutputJSON;
+        }
+        else if (0 == anArg.compare(0, 4, "max="))
+        {
+            okSoFar = parseCount(anArg.substr(4), maximumSize);
+        }
+        else if (0 == anArg.compare(0, 8, "repeats="))
+        {
+            okSoFar = parseCount(anArg.substr(8), numRepeats);
+        }
+        else if (0 == anArg.compare(0, 7, "warmup="))
+        {
+            // Allow warm-up runs to be turned off.
+            numWarmups = 0;
+            okSoFar = (("0" == anArg.substr(7)) || parseCount(anArg.substr(7), numWarmups));
+        }
+        else
+        {
+            okSoFar = false;
+        }
+        if (! okSoFar)
+        {
+            std::cerr << "Unrecognized argument '" << anArg << "'." << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [json | csv] [max=n] [repeats=n] [warmup=n]" <<
+                        std::endl;
+        }
+    }
+    if (okSoFar)
+    {
+        ResultVector results;
+        
+        StartAllocationAccounting();
+        for (size_t ii = 0; (sizeof(kPopulationSizes) / sizeof(*kPopulationSizes)) > ii; ++ii)
+        {
+            size_t populationSize = kPopulationSizes[ii];
+            
+            if (maximumSize >= populationSize)
+            {
+                std::cerr << "Population size " << populationSize << "." << std::endl;
+                benchmarkFunctions(populationSize, numWarmups, numRepeats, results);
+                benchmarkGenome<Skeleton>("Skeleton", populationSize, numWarmups, numRepeats,
+                                          results);
+                benchmarkGenome<Body>("Body", populationSize, numWarmups, numRepeats, results);
+                benchmarkPhases<Skeleton>("Skeleton", populationSize, numWarmups, numRepeats,
+                                          results);
+            }
+        }
+        StopAllocationAccounting();
+        writeResults(std::cout, format, results);
+    }
+    return (okSoFar ? 0 : 1);
+} // main
@@ -0,0 +1,134 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleBinaryAngle.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The definitions for angles stored as binary fractions of a turn.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_BinaryAngle_H_))
+# define Scuddle_BinaryAngle_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+
+# include <array>
+# include <cstdint>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The definitions for angles stored as binary fractions of a turn. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief An angle held as a 16-bit fraction of a full turn.
+     
+     A full turn is 0x10000 units, so that one unit is about 0.0055 degrees and angles wrap
+     around without any range checks. */
+    typedef uint16_t BinaryAngle;
+    
+    /*! @brief The mapping from the octant containing an angle to its quadrant value. */
+    typedef std::array<uint8_t, 8> QuadrantTable;
+    
+    /*! @brief The number of binary angle units in a full turn. */
+    const uint32_t kBinaryAngleFullTurn = 0x10000;
+    
+    /*! @brief The number of binary angle units in an octant. All of the quadrant thresholds are
+     multiples of 45 degrees, so that the octant is enough to determine a quadrant. */
+    const uint32_t kBinaryAngleOctant = (kBinaryAngleFullTurn / 8);
+    
+    /*! @brief Convert a binary angle to degrees.
+     @param inAngle The angle to be converted.
+     @returns The angle as degrees. */
+    inline realType
+    BinaryAngleToDegrees(const BinaryAngle inAngle)
+    {
+        return (inAngle * (static_cast<realType>(360) / kBinaryAngleFullTurn));
+    } // BinaryAngleToDegrees
+    
+    /*! @brief Convert a binary angle to radians.
+     @param inAngle The angle to be converted.
+     @returns The angle as radians. */
+    inline realType
+    BinaryAngleToRadians(const BinaryAngle inAngle)
+    {
+        return DegreesToRadians(BinaryAngleToDegrees(inAngle));
+    } // BinaryAngleToRadians
+    
+    /*! @brief Convert an angle in degrees to the nearest binary angle.
+     @param inAngle The angle to be converted, in degrees.
+     @returns The angle as a binary angle. */
+    inline BinaryAngle
+    DegreesToBinaryAngle(const realType inAngle)
+    {
+        return static_cast<BinaryAngle>(static_cast<int32_t>((inAngle * kBinaryAngleFullTurn /
+                                                              360) + static_cast<realType>(0.5)));
+    } // DegreesToBinaryAngle
+    
+    /*! @brief Convert a binary angle to the desired quadrant.
+     
+     As with MapAngleToQuadrant, an angle that is exactly on a threshold belongs to the lower
+     quadrant. The conversion is a single table lookup, with no branches.
+     @param angle The input angle.
+     @param quadrants The quadrant value for each octant of the turn.
+     @returns The resulting quadrant. */
+    inline int
+    MapBinaryAngleToQuadrant(const BinaryAngle     angle,
+                             const QuadrantTable & quadrants)
+    {
+        return quadrants[static_cast<BinaryAngle>(angle - (0 != angle)) / kBinaryAngleOctant];
+    } // MapBinaryAngleToQuadrant
+    
+    /*! @brief Return a uniformly distributed random binary angle in the range 0..maxAngle,
+     excluding maxAngle.
+     @param generator The random number generator to use.
+     @param maxAngle The upper bound for the output, in degrees; at most 360.
+     @returns A uniformly distributed random binary angle in the range 0..maxAngle. */
+    inline BinaryAngle
+    RandomBinaryAngle(RandomGenerator & generator,
+                      const uint32_t    maxAngle)
+    {
+        return static_cast<BinaryAngle>(generator.nextUnsigned((kBinaryAngleFullTurn * maxAngle /
+                                                                360) - 1));
+    } // RandomBinaryAngle
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_BinaryAngle_H_) */
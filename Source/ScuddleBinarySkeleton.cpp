@@ -0,0 +1,434 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleBinarySkeleton.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for BinarySkeleton objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleBinarySkeleton.h"
+
+#include "ScuddleFitnessCache.h"
+
+#include <type_traits>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for BinarySkeleton objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+// Populations of BinarySkeleton objects are copied and moved around as plain storage.
+static_assert(std::is_trivially_copyable<BinarySkeleton>::value,
+              "BinarySkeleton objects must be trivially copyable");
+
+/*! @brief The smallest difference between two angles, in binary angle units, that is more than
+ 30 degrees. */
+static const int kCriticalAngle = static_cast<int>(30 * kBinaryAngleFullTurn / 360);
+
+/*! @brief The quadrant for each octant of each angle, in Skeleton::AngleIndices order; these
+ match the thresholds used by Skeleton::determineQuadrants. */
+static const QuadrantTable kQuadrantTables[BinarySkeleton::kNumCalculatedAngles] =
+{
+    // kLeftHipToKnee: 90 => 4, 180 => 1, 270 => 2, otherwise 1
+    {{ 4, 4, 1, 1, 2, 2, 1, 1 }},
+    // kLeftKneeToFoot: 45 => 4, 90 => 1, 135 => 2, otherwise 1
+    {{ 4, 1, 2, 1, 1, 1, 1, 1 }},
+    // kRightHipToKnee: 90 => 1, 180 => 4, 270 => 1, otherwise 2
+    {{ 1, 1, 4, 4, 1, 1, 2, 2 }},
+    // kRightKneeToFoot: 45 => 1, 90 => 4, 135 => 1, otherwise 2
+    {{ 1, 4, 1, 2, 2, 2, 2, 2 }},
+    // kLeftShoulderToElbow: 90 => 1, 180 => 2, 270 => 1, otherwise 4
+    {{ 1, 1, 2, 2, 1, 1, 4, 4 }},
+    // kLeftElbowToWrist: 45 => 1, 90 => 2, 135 => 1, otherwise 4
+    {{ 1, 2, 1, 4, 4, 4, 4, 4 }},
+    // kRightShoulderToElbow: 90 => 2, 180 => 1, 270 => 4, otherwise 1
+    {{ 2, 2, 1, 1, 4, 4, 1, 1 }},
+    // kRightElbowToWrist: 45 => 2, 90 => 1, 135 => 4, otherwise 1
+    {{ 2, 1, 4, 1, 1, 1, 1, 1 }}
+};
+
+/*! @brief The starting point for the hashes of the attributes ('BinSkel'). */
+static const uint64_t kHashSeed = 0x42696E536B656C;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+FitnessFactors
+BinarySkeleton::calculateFactors(const BinarySkeletonAngles & angles,
+                                 const FlowQuality            flow,
+                                 const HeightValue            height,
+                                 const SpaceQuality           space,
+                                 const TimeQuality            time,
+                                 const WeightQuality          weight)
+{
+    const FitnessTables & tables = GetFitnessTables();
+    FitnessFactors        result;
+    int                   quadrantScore = 0;
+    size_t                signature = 0;
+    
+    for (size_t ii = 0; kNumCalculatedAngles > ii; ++ii)
+    {
+        int quadrant = MapBinaryAngleToQuadrant(angles[ii], kQuadrantTables[ii]);
+        
+        quadrantScore += quadrant;
+        signature |= QuadrantSignatureBits(ii, quadrant);
+    }
+    uint8_t bartenieffClass = tables.bartenieffClasses[signature];
+    
+    // The angle differences are compared as integers; a BinaryAngle promotes to int.
+    if ((kBartenieffClassDistal == bartenieffClass) || (kBartenieffClassMedial == bartenieffClass))
+    {
+        // Distal or Medial
+        result.bartenieffClass = bartenieffClass;
+    }
+    else if (((std::abs(angles[Skeleton::kLeftShoulderToElbow] -
+                        angles[Skeleton::kLeftHipToKnee]) > kCriticalAngle) &&
+              (std::abs(angles[Skeleton::kLeftElbowToWrist] -
+                        angles[Skeleton::kLeftKneeToFoot]) > kCriticalAngle)) ||
+             ((std::abs(angles[Skeleton::kRightShoulderToElbow] -
+                        angles[Skeleton::kRightHipToKnee]) > kCriticalAngle) &&
+              (std::abs(angles[Skeleton::kRightElbowToWrist] -
+                        angles[Skeleton::kRightKneeToFoot]) > kCriticalAngle)))
+    {
+        // Homolateral
+        result.bartenieffClass = kBartenieffClassHomolateral;
+    }
+    else if (((std::abs(angles[Skeleton::kLeftShoulderToElbow] -
+                        angles[Skeleton::kRightHipToKnee]) > kCriticalAngle) &&
+              (std::abs(angles[Skeleton::kLeftElbowToWrist] -
+                        angles[Skeleton::kRightKneeToFoot]) > kCriticalAngle)) ||
+             ((std::abs(angles[Skeleton::kRightShoulderToElbow] -
+                        angles[Skeleton::kLeftHipToKnee]) > kCriticalAngle) &&
+              (std::abs(angles[Skeleton::kRightElbowToWrist] -
+                        angles[Skeleton::kLeftKneeToFoot]) > kCriticalAngle)))
+    {
+        // Contralateral
+        result.bartenieffClass = kBartenieffClassContralateral;
+    }
+    else
+    {
+        // Homologous, or none
+        result.bartenieffClass = bartenieffClass;
+    }
+    // Laban
+    size_t effort = EffortCode(weight, space, time, flow);
+    
+    result.effortClass = tables.effortClasses[effort];
+    // Height
+    quadrantScore += tables.heightScores[height];
+    if (tables.bentLegs[height])
+    {
+        // No leg is extended - cannot jump without legs in a crouch!
+        result.heightClass = kHeightClassUnextendedLegs;
+    }
+    else
+    {
+        result.heightClass = kHeightClassNone;
+    }
+    result.quadrantScore = static_cast<uint8_t>(quadrantScore);
+    return result;
+} // BinarySkeleton::calculateFactors
+
+uint64_t
+BinarySkeleton::calculateHash(const BinarySkeletonAngles & angles,
+                              const FlowQuality            flow,
+                              const HeightValue            height,
+                              const SpaceQuality           space,
+                              const TimeQuality            time,
+                              const WeightQuality          weight)
+{
+    uint64_t result = kHashSeed;
+    
+    for (size_t ii = 0; kNumCalculatedAngles > ii; ++ii)
+    {
+        result = HashCombine(result, angles[ii]);
+    }
+    result = HashCombine(result, weight);
+    result = HashCombine(result, space);
+    result = HashCombine(result, time);
+    result = HashCombine(result, flow);
+    return HashCombine(result, height);
+} // BinarySkeleton::calculateHash
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+BinarySkeleton::BinarySkeleton(void) :
+    _marked(false)
+{
+    setAttributes(GetThreadRandomGenerator());
+} // BinarySkeleton::BinarySkeleton
+
+BinarySkeleton::BinarySkeleton(RandomGenerator & generator) :
+    _marked(false)
+{
+    setAttributes(generator);
+} // BinarySkeleton::BinarySkeleton
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+realType
+BinarySkeleton::getAngle(const size_t index)
+const
+{
+    realType result;
+    
+    if (kNumCalculatedAngles > index)
+    {
+        result = BinaryAngleToRadians(_angles[index]);
+    }
+    else
+    {
+        result = 0;
+    }
+    return result;
+} // BinarySkeleton::getAngle
+
+realType
+BinarySkeleton::getAngleAsDegrees(const size_t index)
+const
+{
+    realType result;
+    
+    if (kNumCalculatedAngles > index)
+    {
+        result = BinaryAngleToDegrees(_angles[index]);
+    }
+    else
+    {
+        result = RadiansToDegrees(RandomAngle(360));
+    }
+    return result;
+} // BinarySkeleton::getAngleAsDegrees
+
+glm::quat
+BinarySkeleton::getAngleAsQuaternion(const size_t index)
+const
+{
+    realType angle;
+    
+    if (kNumCalculatedAngles > index)
+    {
+        angle = BinaryAngleToRadians(_angles[index]);
+    }
+    else
+    {
+        angle = RandomAngle(360);
+    }
+    return glm::quat_cast(glm::rotate(glm::mat4(1), angle, glm::vec3(0, 0, 1)));
+} // BinarySkeleton::getAngleAsQuaternion
+
+uint64_t
+BinarySkeleton::getAttributeHash(void)
+const
+{
+    return calculateHash(_angles, _flow, _height, _space, _time, _weight);
+} // BinarySkeleton::getAttributeHash
+
+void
+BinarySkeleton::mutate(RandomGenerator & generator)
+{
+    size_t whichAngle = generator.nextUnsigned(kNumCalculatedAngles - 1);
+    
+    switch (whichAngle)
+    {
+        case Skeleton::kLeftShoulderToElbow :
+        case Skeleton::kRightShoulderToElbow :
+        case Skeleton::kLeftHipToKnee :
+        case Skeleton::kRightHipToKnee :
+            _angles[whichAngle] = RandomBinaryAngle(generator, 360);
+            break;
+            
+        case Skeleton::kLeftElbowToWrist :
+        case Skeleton::kRightElbowToWrist :
+        case Skeleton::kLeftKneeToFoot :
+        case Skeleton::kRightKneeToFoot :
+            _angles[whichAngle] = RandomBinaryAngle(generator, 180);
+            break;
+            
+        default :
+            break;
+            
+    }
+} // BinarySkeleton::mutate
+
+void
+BinarySkeleton::setAttributes(RandomGenerator & generator)
+{
+    _angles[Skeleton::kLeftShoulderToElbow] = RandomBinaryAngle(generator, 360);
+    _angles[Skeleton::kLeftElbowToWrist] = RandomBinaryAngle(generator, 180);
+    _angles[Skeleton::kRightShoulderToElbow] = RandomBinaryAngle(generator, 360);
+    _angles[Skeleton::kRightElbowToWrist] = RandomBinaryAngle(generator, 180);
+    _angles[Skeleton::kLeftHipToKnee] = RandomBinaryAngle(generator, 360);
+    _angles[Skeleton::kLeftKneeToFoot] = RandomBinaryAngle(generator, 180);
+    _angles[Skeleton::kRightHipToKnee] = RandomBinaryAngle(generator, 360);
+    _angles[Skeleton::kRightKneeToFoot] = RandomBinaryAngle(generator, 180);
+    _flow = ((0.5 <= generator.nextReal(0, 1)) ? kFlowBound : kFlowFree);
+    _space = ((0.5 <= generator.nextReal(0, 1)) ? kSpaceDirect : kSpaceIndirect);
+    _time = ((0.5 <= generator.nextReal(0, 1)) ? kTimeSudden : kTimeSustained);
+    _weight = ((0.5 <= generator.nextReal(0, 1)) ? kWeightStrong : kWeightLight);
+    realType aNumb = generator.nextReal(0, 1);
+    
+    if (0.8 <= aNumb)
+    {
+        _height = kHeightHigh;
+    }
+    else if (0.6 <= aNumb)
+    {
+        _height = kHeightMidHigh;
+    }
+    else if (0.4 <= aNumb)
+    {
+        _height = kHeightMiddle;
+    }
+    else if (0.2 <= aNumb)
+    {
+        _height = kHeightMidLow;
+    }
+    else
+    {
+        _height = kHeightLow;
+    }
+    _factors.bartenieffClass = kBartenieffClassNone;
+    _factors.effortClass = kEffortClassLow;
+    _factors.heightClass = kHeightClassNone;
+    _factors.quadrantScore = 0;
+} // BinarySkeleton::setAttributes
+
+void
+BinarySkeleton::swapValues(BinarySkeleton &  other,
+                           const size_t      numSwap,
+                           RandomGenerator & generator)
+{
+    size_t realSwap;
+    
+    if (kNumAttributes < numSwap)
+    {
+        realSwap = kNumAttributes;
+    }
+    else
+    {
+        realSwap = numSwap;
+    }
+    // Collect a set of distinct indices to swap.
+    bool   chosen[kNumAttributes] = { false };
+    size_t numChosen = 0;
+    
+    do
+    {
+        size_t anIndex = generator.nextUnsigned(kNumAttributes - 1);
+        
+        if (! chosen[anIndex])
+        {
+            chosen[anIndex] = true;
+            ++numChosen;
+        }
+    }
+    while (realSwap > numChosen);
+    for (size_t ii = 0; kNumAttributes > ii; ++ii)
+    {
+        if (chosen[ii])
+        {
+            switch (ii)
+            {
+                case 0 :
+                    std::swap(_weight, other._weight);
+                    break;
+                    
+                case 1 :
+                    std::swap(_space, other._space);
+                    break;
+                    
+                case 2 :
+                    std::swap(_time, other._time);
+                    break;
+                    
+                case 3 :
+                    std::swap(_flow, other._flow);
+                    break;
+                    
+                case 4 : // This is (kNumFixedAttributes - 1).
+                    std::swap(_height, other._height);
+                    break;
+                    
+                default :
+                    // Angles -
+                    std::swap(_angles[ii - kNumFixedAttributes],
+                              other._angles[ii - kNumFixedAttributes]);
+                    break;
+                    
+            }
+        }
+    }
+} // BinarySkeleton::swapValues
+
+bool
+BinarySkeleton::updateFitness(const FitnessCoefficients & coefficients)
+{
+    _factors = calculateFactors(_angles, _flow, _height, _space, _time, _weight);
+    rescoreFitness(coefficients);
+    return true;
+} // BinarySkeleton::updateFitness
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
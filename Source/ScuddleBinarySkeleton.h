@@ -0,0 +1,374 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleBinarySkeleton.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for BinarySkeleton objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_BinarySkeleton_H_))
+# define Scuddle_BinarySkeleton_H_ /* Header guard */
+
+# include "ScuddleBinaryAngle.h"
+# include "ScuddleSkeleton.h"
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for BinarySkeleton objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief The angles of a BinarySkeleton, indexed by Skeleton::AngleIndices. */
+    typedef std::array<BinaryAngle, Skeleton::kNumCalculatedAngles> BinarySkeletonAngles;
+    
+    /*! @brief The Scuddle BinarySkeleton structure.
+     
+     A BinarySkeleton has the same attributes and fitness rules as a Skeleton, and shares its
+     fitness coefficients, but holds its angles as binary angles; the quadrants are found by
+     table lookup and the angle comparisons are done on integers. The angles are indexed by
+     Skeleton::AngleIndices. */
+    class BinarySkeleton
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The attributes are set using the random number generator for the calling thread. */
+        BinarySkeleton(void);
+        
+        /*! @brief The constructor.
+         @param generator The random number generator used to set the attributes. */
+        explicit
+        BinarySkeleton(RandomGenerator & generator);
+        
+        /*! @brief The copy constructor.
+         @param other The BinarySkeleton to be copied. */
+        BinarySkeleton(const BinarySkeleton & other) = default;
+        
+        /*! @brief The move constructor.
+         @param other The BinarySkeleton to be moved. */
+        BinarySkeleton(BinarySkeleton && other) = default;
+        
+        /*! @brief The destructor. */
+        ~BinarySkeleton(void) = default;
+        
+        /*! @brief Calculate the fitness factors for a set of attributes.
+         
+         The quadrants are found by table lookup and the angles are compared as integers, with
+         the same rules as Skeleton::updateFitness.
+         @param angles The angles to be evaluated.
+         @param flow The Flow Quality value.
+         @param height The Height level value.
+         @param space The Space Quality value.
+         @param time The Time Quality value.
+         @param weight The Weight Quality value.
+         @returns The fitness factors for the attributes. */
+        static FitnessFactors
+        calculateFactors(const BinarySkeletonAngles & angles,
+                         const FlowQuality            flow,
+                         const HeightValue            height,
+                         const SpaceQuality           space,
+                         const TimeQuality            time,
+                         const WeightQuality          weight);
+        
+        /*! @brief Calculate a hash of a set of attributes.
+         
+         The hash does not depend on how the attributes are stored, so that a BinarySkeleton and
+         a PackedSkeleton with the same attributes have the same hash.
+         @param angles The angles to be hashed.
+         @param flow The Flow Quality value.
+         @param height The Height level value.
+         @param space The Space Quality value.
+         @param time The Time Quality value.
+         @param weight The Weight Quality value.
+         @returns The hash of the attributes. */
+        static uint64_t
+        calculateHash(const BinarySkeletonAngles & angles,
+                      const FlowQuality            flow,
+                      const HeightValue            height,
+                      const SpaceQuality           space,
+                      const TimeQuality            time,
+                      const WeightQuality          weight);
+        
+        /*! @brief Unmark the object. */
+        void
+        clearMark(void)
+        {
+            _marked = false;
+        } // clearMark
+        
+        /*! @brief Return a specific angle (in radians).
+         @param index The index of the angle to be returned.
+         @returns The specified angle, in radians. */
+        realType
+        getAngle(const size_t index)
+        const;
+        
+        /*! @brief Return a specific angle (in degrees).
+         @param index The index of the angle to be returned.
+         @returns The specified angle, in degrees. */
+        realType
+        getAngleAsDegrees(const size_t index)
+        const;
+        
+        /*! @brief Return a specific angle as a quaternion.
+         @param index The index of the angle to be returned.
+         @returns The specified angle as a quaternion. */
+        glm::quat
+        getAngleAsQuaternion(const size_t index)
+        const;
+        
+        /*! @brief Return a hash of the attributes that determine the fitness value.
+         @returns A hash of the attributes that determine the fitness value. */
+        uint64_t
+        getAttributeHash(void)
+        const;
+        
+        /*! @brief Return a specific angle, as it is stored.
+         @param index The index of the angle to be returned.
+         @returns The specified angle. */
+        BinaryAngle
+        getBinaryAngle(const size_t index)
+        const
+        {
+            return _angles[index];
+        } // getBinaryAngle
+        
+        /*! @brief Return the factors found by the last evaluation.
+         @returns The factors found by the last evaluation. */
+        const FitnessFactors &
+        getFitnessFactors(void)
+        const
+        {
+            return _factors;
+        } // getFitnessFactors
+        
+        /*! @brief Return the calculated fitness score.
+         @returns The calculated fitness score. */
+        realType
+        getFitnessScore(void)
+        const
+        {
+            return _accumulatedScore;
+        } // getFitnessScore
+        
+        /*! @brief Return the Flow Quality.
+         @returns The Flow Quality value. */
+        FlowQuality
+        getFlow(void)
+        const
+        {
+            return _flow;
+        } // getFlow
+        
+        /*! @brief Return the Height level.
+         @returns The Height level value. */
+        HeightValue
+        getHeight(void)
+        const
+        {
+            return _height;
+        } // getHeight
+        
+        /*! @brief Return the number of angles.
+         @returns The number of angles. */
+        size_t
+        getNumAngles(void)
+        const
+        {
+            return kNumCalculatedAngles;
+        } // getNumAngles
+        
+        /*! @brief Return the Space Quality.
+         @returns The Space Quality value. */
+        SpaceQuality
+        getSpace(void)
+        const
+        {
+            return _space;
+        } // getSpace
+        
+        /*! @brief Return the Time Quality.
+         @returns The Time Quality value. */
+        TimeQuality
+        getTime(void)
+        const
+        {
+            return _time;
+        } // getTime
+        
+        /*! @brief Return the Weight Quality.
+         @returns The Weight Quality value. */
+        WeightQuality
+        getWeight(void)
+        const
+        {
+            return _weight;
+        } // getWeight
+        
+        /*! @brief Return @c true if the object is marked.
+         @returns @c true if the object is marked. */
+        bool
+        isMarked(void)
+        const
+        {
+            return _marked;
+        } // isMarked
+        
+        /*! @brief Mutate a value of the object.
+         @param generator The random number generator to use. */
+        void
+        mutate(RandomGenerator & generator);
+        
+        /*! @brief The assignment operator.
+         @param other The BinarySkeleton to be copied.
+         @returns The updated object. */
+        BinarySkeleton &
+        operator =(const BinarySkeleton & other) = default;
+        
+        /*! @brief The move assignment operator.
+         @param other The BinarySkeleton to be moved.
+         @returns The updated object. */
+        BinarySkeleton &
+        operator =(BinarySkeleton && other) = default;
+        
+        /*! @brief Recalculate the fitness value from the factors found by the last evaluation.
+         
+         The attributes must not have changed since the last evaluation.
+         @param coefficients The fitness coefficients to be applied. */
+        void
+        rescoreFitness(const FitnessCoefficients & coefficients)
+        {
+            _accumulatedScore = ScoreFitnessFactors(coefficients, _factors);
+        } // rescoreFitness
+        
+        /*! @brief Set the factors to those found by a previous evaluation of the same
+         attributes.
+         
+         The fitness value is not changed; use rescoreFitness to apply the fitness coefficients.
+         @param factors The factors for the current attributes. */
+        void
+        setFitnessFactors(const FitnessFactors & factors)
+        {
+            _factors = factors;
+        } // setFitnessFactors
+        
+        /*! @brief Mark the object. */
+        void
+        setMark(void)
+        {
+            _marked = true;
+        } // setMark
+        
+        /*! @brief Choose a set of values and swap with another BinarySkeleton.
+         @param other The other BinarySkeleton to be modified.
+         @param numSwap The number of values to be exchanged.
+         @param generator The random number generator to use. */
+        void
+        swapValues(BinarySkeleton &  other,
+                   const size_t      numSwap,
+                   RandomGenerator & generator);
+        
+        /*! @brief Determine the fitness value for this object.
+         
+         Every call evaluates the object completely.
+         @param coefficients The fitness coefficients to be applied.
+         @returns @c true, as the object is always evaluated. */
+        bool
+        updateFitness(const FitnessCoefficients & coefficients);
+        
+    protected :
+    
+    private :
+        
+        /*! @brief Set the attributes to random values.
+         @param generator The random number generator to use. */
+        void
+        setAttributes(RandomGenerator & generator);
+        
+    public :
+        
+        /*! @brief The number of angles in each BinarySkeleton. */
+        static const size_t kNumCalculatedAngles = Skeleton::kNumCalculatedAngles;
+        
+        /*! @brief The number of attributes in each BinarySkeleton that are not angles. */
+        static const size_t kNumFixedAttributes = Skeleton::kNumFixedAttributes;
+        
+        /*! @brief The number of attributes that can be swapped. */
+        static const size_t kNumAttributes = Skeleton::kNumAttributes;
+        
+    protected :
+    
+    private :
+        
+        /*! @brief The angles to be worked with. */
+        BinarySkeletonAngles _angles;
+        
+        /*! @brief The calculated fitness score. */
+        realType _accumulatedScore;
+        
+        /*! @brief The Flow Effort Quality value. */
+        FlowQuality _flow;
+        
+        /*! @brief The height level. */
+        HeightValue _height;
+        
+        /*! @brief The Space Effort Quality value. */
+        SpaceQuality _space;
+        
+        /*! @brief The Time Effort Quality value. */
+        TimeQuality _time;
+        
+        /*! @brief The Weight Effort Quality value. */
+        WeightQuality _weight;
+        
+        /*! @brief The factors found by the last evaluation. */
+        FitnessFactors _factors;
+        
+        /*! @brief @c true if the object has been marked and @c false otherwise. */
+        bool _marked;
+        
+    }; // BinarySkeleton
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_BinarySkeleton_H_) */
@@ -40,6 +40,7 @@
 # define Scuddle_Body_H_ /* Header guard */
 
 # include "ScuddleCommon.h"
+# include "ScuddleFitnessTables.h"
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -60,35 +61,29 @@ namespace Scuddle
     {
     public :
         
-# if defined(GENERATE_POSITIONS_)
         /*! @brief The constructor.
-         @param leftHip The initial coordinates of the left side of the hips.
-         @param leftShoulder The initial coordinates of the left shoulder.
-         @param neck The initial coordinates of the neck.
-         @param rightHip The initial coordinates of the right side of the hips.
-         @param rightShoulder The initial coordinates of the right shoulder.
-         @param tail The initial coordinates of the 'tail. */
-        Body(const Coordinate2D & leftHip,
-             const Coordinate2D & leftShoulder,
-             const Coordinate2D & neck,
-             const Coordinate2D & rightHip,
-             const Coordinate2D & rightShoulder,
-             const Coordinate2D & tail);
-# endif // defined(GENERATE_POSITIONS_)
-
-# if (! defined(GENERATE_POSITIONS_))
-        /*! @brief The constructor. */
+         
+         The attributes are set using the random number generator for the calling thread. */
         Body(void);
-# endif // ! defined(GENERATE_POSITIONS_))
+        
+        /*! @brief The constructor.
+         @param generator The random number generator used to set the attributes. */
+        explicit
+        Body(RandomGenerator & generator);
         
         /*! @brief The copy constructor.
+         
+         A Body holds all of its values inline, so that copying it is a plain copy of its storage,
+         including the mark.
          @param other The Body to be copied. */
-        explicit
-        Body(const Body & other);
+        Body(const Body & other) = default;
+        
+        /*! @brief The move constructor.
+         @param other The Body to be moved. */
+        Body(Body && other) = default;
         
         /*! @brief The destructor. */
-        virtual
-        ~Body(void);
+        ~Body(void) = default;
         
         /*! @brief Unmark the object. */
         void
@@ -97,6 +92,21 @@ namespace Scuddle
             _marked = false;
         } // clearMark
         
+        /*! @brief Return a hash of the attributes that determine the fitness value.
+         @returns A hash of the attributes that determine the fitness value. */
+        uint64_t
+        getAttributeHash(void)
+        const;
+        
+        /*! @brief Return the factors found by the last evaluation.
+         @returns The factors found by the last evaluation. */
+        const FitnessFactors &
+        getFitnessFactors(void)
+        const
+        {
+            return _factors;
+        } // getFitnessFactors
+        
         /*! @brief Return the calculated fitness score.
          @returns The calculated fitness score. */
         realType
@@ -124,17 +134,6 @@ namespace Scuddle
             return _height;
         } // getHeight
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the left elbow.
-         @returns The coordinates of the left elbow. */
-        const Coordinate2D &
-        getLeftElbow(void)
-        const
-        {
-            return _leftElbow;
-        } // getLeftElbow
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the angle from the left elbow to the left wrist.
          @returns The angle from the left elbow to the left wrist. */
         realType
@@ -153,28 +152,6 @@ namespace Scuddle
             return _leftElbowToWristQuadrant;
         } // getLeftElbowToWristQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the left foot.
-         @returns The coordinates of the left foot. */
-        const Coordinate2D &
-        getLeftFoot(void)
-        const
-        {
-            return _leftFoot;
-        } // getLeftFoot
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the left side of the hips.
-         @returns The coordinates of the left side of the hips. */
-        const Coordinate2D &
-        getLeftHip(void)
-        const
-        {
-            return _leftHip;
-        } // getLeftHip
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the angle from the left side of the hips to the left knee.
          @returns The angle from the left side of the hips to the left knee. */
         realType
@@ -193,24 +170,13 @@ namespace Scuddle
             return _leftHipToKneeQuadrant;
         } // getLeftHipToKneeQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the left knee.
-         @returns The coordinates of the left knee. */
-        const Coordinate2D &
-        getLeftKnee(void)
-        const
-        {
-            return _leftKnee;
-        } // getLeftKnee
-# endif // defined(GENERATE_POSITIONS_)
-
         /*! @brief Return the angle from the left knee to the left foot.
          @returns The angle from the left knee to the left foot. */
         realType
         getLeftKneeToFootAngle(void)
         const
         {
-            return _leftElbowToWristAngle;
+            return _leftKneeToFootAngle;
         } // getLeftKneeToFootAngle
         
         /*! @brief Return the quadrant of the angle from the left knee to the left foot.
@@ -222,17 +188,6 @@ namespace Scuddle
             return _leftKneeToFootQuadrant;
         } // getLeftKneeToFootQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the left shoulder.
-         @returns The coordinates of the left shoulder. */
-        const Coordinate2D &
-        getLeftShoulder(void)
-        const
-        {
-            return _leftShoulder;
-        } // getLeftShoulder
-# endif // defined(GENERATE_POSITIONS_)
-
         /*! @brief Return the angle from the left shoulder to the left elbow.
          @returns The angle from the left shoulder to the left elbow. */
         realType
@@ -251,39 +206,6 @@ namespace Scuddle
             return _leftShoulderToElbowQuadrant;
         } // getLeftShoulderToElbowQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the left wrist.
-         @returns The coordinates of the left wrist. */
-        const Coordinate2D &
-        getLeftWrist(void)
-        const
-        {
-            return _leftWrist;
-        } // getLeftWrist
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the neck.
-         @returns The coordinates of the neck. */
-        const Coordinate2D &
-        getNeck(void)
-        const
-        {
-            return _neck;
-        } // getNeck
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the right elbow.
-         @returns The coordinates of the right elbow. */
-        const Coordinate2D &
-        getRightElbow(void)
-        const
-        {
-            return _rightElbow;
-        } // getRightElbow
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the angle from the right elbow to the right wrist.
          @returns The angle from the right elbow to the right wrist. */
         realType
@@ -302,28 +224,6 @@ namespace Scuddle
             return _rightElbowToWristQuadrant;
         } // getRightElbowToWristQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the right foot.
-         @returns The coordinates of the right foot. */
-        const Coordinate2D &
-        getRightFoot(void)
-        const
-        {
-            return _rightFoot;
-        } // getRightFoot
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the right side of the hips.
-         @returns The coordinates of the right side of the hips. */
-        const Coordinate2D &
-        getRightHip(void)
-        const
-        {
-            return _rightHip;
-        } // getRightHip
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the angle from the right side of the hips to the right knee.
          @returns The angle from the right side of the hips to the right knee. */
         realType
@@ -343,24 +243,13 @@ namespace Scuddle
             return _rightHipToKneeQuadrant;
         } // getRightHipToKneeQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the right knee.
-         @returns The coordinates of the right knee. */
-        const
-        Coordinate2D & getRightKnee(void)
-        const
-        {
-            return _rightKnee;
-        } // getRightKnee
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the angle from the right knee to the right foot.
          @returns The angle from the right knee to the right foot. */
         realType
         getRightKneeToFootAngle(void)
         const
         {
-            return _rightElbowToWristAngle;
+            return _rightKneeToFootAngle;
         } // getRightKneeToFootAngle
         
         /*! @brief Return the quadrant of the angle from the right knee to the right foot.
@@ -372,17 +261,6 @@ namespace Scuddle
             return _rightKneeToFootQuadrant;
         } // getRightKneeToFootQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the right shoulder.
-         @returns The coordinates of the right shoulder. */
-        const Coordinate2D &
-        getRightShoulder(void)
-        const
-        {
-            return _rightShoulder;
-        } // getRightShoulder
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the angle from the right shoulder to the right elbow.
          @returns The angle from the right shoulder to the right elbow. */
         realType
@@ -401,17 +279,6 @@ namespace Scuddle
             return _rightShoulderToElbowQuadrant;
         } // getRightShoulderToElbowQuadrant
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the right wrist.
-         @returns The coordinates of the right wrist. */
-        const Coordinate2D &
-        getRightWrist(void)
-        const
-        {
-            return _rightWrist;
-        } // getRightWrist
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the Space Quality.
          @returns The Space Quality value. */
         SpaceQuality
@@ -421,17 +288,6 @@ namespace Scuddle
             return _space;
         } // getSpace
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Return the coordinates of the 'tail'.
-         @returns The coordinates of the 'tail'. */
-        const Coordinate2D &
-        getTail(void)
-        const
-        {
-            return _tail;
-        } // getTail
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief Return the Time Quality.
          @returns The Time Quality value. */
         TimeQuality
@@ -459,13 +315,44 @@ namespace Scuddle
             return _marked;
         } // isMarked
         
-        /*! @brief Mutate a value of the object. */
+        /*! @brief Mutate a value of the object.
+         @param generator The random number generator to use. */
         void
-        mutate(void);
+        mutate(RandomGenerator & generator);
+        
+        /*! @brief The assignment operator.
+         @param other The Body to be copied.
+         @returns The updated object. */
+        Body &
+        operator =(const Body & other) = default;
+        
+        /*! @brief The move assignment operator.
+         @param other The Body to be moved.
+         @returns The updated object. */
+        Body &
+        operator =(Body && other) = default;
+        
+        /*! @brief Recalculate the fitness value from the factors found by the last evaluation.
+         
+         The attributes must not have changed since the last evaluation.
+         @param coefficients The fitness coefficients to be applied. */
+        void
+        rescoreFitness(const FitnessCoefficients & coefficients)
+        {
+            _accumulatedScore = ScoreFitnessFactors(coefficients, _factors);
+        } // rescoreFitness
         
-        /*! @brief Reset the fitness parameters to their initial settings. */
-        static void
-        resetParameters(void);
+        /*! @brief Set the factors to those found by a previous evaluation of the same
+         attributes.
+         
+         The fitness value and the quadrants are not changed; use rescoreFitness to apply the
+         fitness coefficients.
+         @param factors The factors for the current attributes. */
+        void
+        setFitnessFactors(const FitnessFactors & factors)
+        {
+            _factors = factors;
+        } // setFitnessFactors
         
         /*! @brief Mark the object. */
         void
@@ -474,178 +361,45 @@ namespace Scuddle
             _marked = true;
         } // setMark
         
-# if defined(USE_FRACTION_FOR_CROSSOVER_)
-        /*! @brief Choose a set of values and swap with another Body.
-         @param other The other Body to be modified.
-         @param fraction The fraction of the values to be exchanged. */
-        void
-        swapValues(Body &         other,
-                   const realType fraction);
-# else // ! defined(USE_FRACTION_FOR_CROSSOVER_)
         /*! @brief Choose a set of values and swap with another Body.
          @param other The other Body to be modified.
-         @param numSwap The number of values to be exchanged. */
+         @param numSwap The number of values to be exchanged.
+         @param generator The random number generator to use. */
         void
-        swapValues(Body &       other,
-                   const size_t numSwap);
-# endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-        
-        /*! @brief Determine the fitness value for this object. */
-        void
-        updateFitness(void);
+        swapValues(Body &            other,
+                   const size_t      numSwap,
+                   RandomGenerator & generator);
+        
+        /*! @brief Determine the fitness value for this object.
+         
+         Every call evaluates the object completely.
+         @param coefficients The fitness coefficients to be applied.
+         @returns @c true, as the object is always evaluated. */
+        bool
+        updateFitness(const FitnessCoefficients & coefficients);
         
     protected :
     
     private :
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The constructor. */
-        Body(void);
-# endif // defined(GENERATE_POSITIONS_))
-        
         /*! @brief Determine the quadrants for the various angles. */
         void
         determineQuadrants(void);
         
-        /*! @brief Set the attributes to random values. */
+        /*! @brief Set the attributes to random values.
+         @param generator The random number generator to use. */
         void
-        setAttributes(void);
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief Set the joint positions from the angles. */
-        void
-        setPositions(void);
-# endif // defined(GENERATE_POSITIONS_)
+        setAttributes(RandomGenerator & generator);
         
     public :
-    
-        /*! @brief The fitness coefficient for Bartenieff contralateral configurations. */
-        static ConstrainedRealValue bartenieffContralateral;
-        
-        /*! @brief The fitness coefficient for Bartenieff distal configurations. */
-        static ConstrainedRealValue bartenieffDistal;
-        
-        /*! @brief The fitness coefficient for Bartenieff homolateral configurations. */
-        static ConstrainedRealValue bartenieffHomolateral;
-        
-        /*! @brief The fitness coefficient for Bartenieff homologous configurations. */
-        static ConstrainedRealValue bartenieffHomologous;
-        
-        /*! @brief The fitness coefficient for Bartenieff medial configurations. */
-        static ConstrainedRealValue bartenieffMedial;
-        
-        /*! @brief The fitness coefficient for high Effort configurations. */
-        static ConstrainedRealValue effortHigh;
-        
-        /*! @brief The fitness coefficient for low Effort configurations. */
-        static ConstrainedRealValue effortLow;
-        
-        /*! @brief The fitness coefficient for medium Effort configurations. */
-        static ConstrainedRealValue effortMedium;
-        
-        /*! @brief The fitness coefficient for fully extended leg configurations. */
-        static ConstrainedRealValue fullyExtendedLeg;
-        
-        /*! @brief The fitness coefficient for lower leg extended configurations. */
-        static ConstrainedRealValue lowerLegExtended;
-
-        /*! @brief The fitness coefficient for unextended leg configurations. */
-        static ConstrainedRealValue unextendedLegs;
         
+        /*! @brief The number of attributes that can be swapped. */
+        static const size_t kNumAttributes = 13;
+    
     protected :
     
     private :
         
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The initial position of the left side of the hips. */
-        Coordinate2D _initLeftHip;
-# endif // defined(GENERATE_POSITIONS_)
-
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The initial position of the left shoulder. */
-        Coordinate2D _initLeftShoulder;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The initial position of the right side of the hips. */
-        Coordinate2D _initRightHip;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The initial position of the right shoulder. */
-        Coordinate2D _initRightShoulder;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the left elbow. */
-        Coordinate2D _leftElbow;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the left foot. */
-        Coordinate2D _leftFoot;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the left side of the hips. */
-        Coordinate2D _leftHip;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the left knee. */
-        Coordinate2D _leftKnee;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the left shoulder. */
-        Coordinate2D _leftShoulder;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the left wrist. */
-        Coordinate2D _leftWrist;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the neck. */
-        Coordinate2D _neck;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the right elbow. */
-        Coordinate2D _rightElbow;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the right foot. */
-        Coordinate2D _rightFoot;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the right side of the hips. */
-        Coordinate2D _rightHip;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the right knee. */
-        Coordinate2D _rightKnee;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the right shoulder. */
-        Coordinate2D _rightShoulder;
-# endif // defined(GENERATE_POSITIONS_)
-        
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the right wrist. */
-        Coordinate2D _rightWrist;
-# endif // defined(GENERATE_POSITIONS_)
-
-# if defined(GENERATE_POSITIONS_)
-        /*! @brief The position of the 'tail'. */
-        Coordinate2D _tail;
-# endif // defined(GENERATE_POSITIONS_)
-        
         /*! @brief The quadrant of the angle from the left elbow to the left wrist. */
         int _leftElbowToWristQuadrant;
         
@@ -715,6 +469,9 @@ namespace Scuddle
         /*! @brief The Weight Effort Quality value. */
         WeightQuality _weight;
         
+        /*! @brief The factors found by the last evaluation. */
+        FitnessFactors _factors;
+        
         /*! @brief @c true if the object has been marked and @c false otherwise. */
         bool _marked;
         
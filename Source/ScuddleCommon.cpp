@@ -38,6 +38,17 @@
 
 #include "ScuddleCommon.h"
 
+#include "ScuddleAllocationCounters.h"
+
+#include <cstdint>
+#include <cstdlib>
+#if MAC_OR_LINUX_
+# include <sys/mman.h>
+# include <unistd.h>
+#else // ! MAC_OR_LINUX_
+# include <malloc.h>
+#endif // ! MAC_OR_LINUX_
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -59,18 +70,10 @@ using namespace Scuddle;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
-/*! @brief The clip range for the random number generator - must be less than the output range of
- the rand() function. */
-static const int kModulus = 1000;
-
-/*! @brief @c true if the value for PI has been set and @c false otherwise. */
-static bool lPiSet = false;
-
-/*! @brief @c true if the random number generator has been seeded and @c false otherwise. */
-static bool lRandomSeeded = false;
-
-/*! @brief The value of PI. */
-static realType lPi = static_cast<realType>(3.14159265);
+#if (! MAC_OR_LINUX_)
+/*! @brief The alignment of blocks from AllocatePages, when pages cannot be mapped directly. */
+static const size_t kPageAlignment = 4096;
+#endif // ! MAC_OR_LINUX_
 
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
@@ -80,20 +83,33 @@ static realType lPi = static_cast<realType>(3.14159265);
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
-/*! @brief Seed the random number generator. */
-static void
-initRandom(void)
+#if MAC_OR_LINUX_
+/*! @brief Return the number of bytes that are mapped for a block from AllocatePages.
+ @param numBytes The requested size of the block, in bytes.
+ @param useHugePages @c true if the block is to be backed by huge pages.
+ @returns The requested size, rounded up to a whole number of pages. */
+static size_t
+getMappedSize(const size_t numBytes,
+              const bool   useHugePages)
 {
-    if (! lRandomSeeded)
-    {
-#if defined(__APPLE__)
-        sranddev();
-#else // ! defined(__APPLE__)
-        srand(clock());
-#endif // ! defined(__APPLE__)
-        lRandomSeeded = true;
-    }
-} // initRandom
+    size_t pageSize = (useHugePages ? kHugePageSize : static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+    
+    return (((numBytes + pageSize - 1) / pageSize) * pageSize);
+} // getMappedSize
+#endif // MAC_OR_LINUX_
+
+/*! @brief Return the value of PI.
+ 
+ The value is calculated once, in a thread-safe manner, so that the angle conversions can be used
+ from several threads at the same time.
+ @returns The value of PI. */
+static realType
+getPi(void)
+{
+    static const realType pi = (4 * static_cast<realType>(atan2(1, 1)));
+    
+    return pi;
+} // getPi
 
 #if defined(__APPLE__)
 # pragma mark Class methods
@@ -111,15 +127,94 @@ initRandom(void)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
 
-realType
-Scuddle::DegreesToRadians(const realType inAngle)
+void *
+Scuddle::AllocateAligned(const size_t numBytes,
+                         const size_t alignment)
+{
+    void * result;
+    
+#if MAC_OR_LINUX_
+    if (posix_memalign(&result, alignment, numBytes))
+    {
+        result = nullptr;
+    }
+    RecordBlockAllocation(result);
+#else // ! MAC_OR_LINUX_
+    result = _aligned_malloc(numBytes, alignment);
+#endif // ! MAC_OR_LINUX_
+    return result;
+} // Scuddle::AllocateAligned
+
+void *
+Scuddle::AllocatePages(const size_t numBytes,
+                       const bool   useHugePages)
 {
-    if (! lPiSet)
+    void * result;
+    
+#if MAC_OR_LINUX_
+    size_t mappedBytes = getMappedSize(numBytes, useHugePages);
+    
+    if (useHugePages)
     {
-        lPi = (4 * static_cast<realType>(atan2(1, 1)));
-        lPiSet = true;
+        // Map an extra huge page, so that the block can be trimmed to start on a huge page
+        // boundary; the kernel can only back aligned ranges with huge pages.
+        void * rawBlock = mmap(nullptr, mappedBytes + kHugePageSize, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        
+        if (MAP_FAILED == rawBlock)
+        {
+            result = nullptr;
+        }
+        else
+        {
+            uintptr_t rawAddress = reinterpret_cast<uintptr_t>(rawBlock);
+            uintptr_t address = ((rawAddress + kHugePageSize - 1) &
+                                 ~static_cast<uintptr_t>(kHugePageSize - 1));
+            size_t    leadingBytes = (address - rawAddress);
+            size_t    trailingBytes = (kHugePageSize - leadingBytes);
+            
+            if (leadingBytes)
+            {
+                munmap(rawBlock, leadingBytes);
+            }
+            if (trailingBytes)
+            {
+                munmap(reinterpret_cast<void *>(address + mappedBytes), trailingBytes);
+            }
+            result = reinterpret_cast<void *>(address);
+# if defined(MADV_HUGEPAGE)
+            // This is advice only; if it is refused, the block is still usable.
+            madvise(result, mappedBytes, MADV_HUGEPAGE);
+# endif // defined(MADV_HUGEPAGE)
+        }
+    }
+    else
+    {
+        result = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                      -1, 0);
+        if (MAP_FAILED == result)
+        {
+            result = nullptr;
+        }
+    }
+    if (result)
+    {
+        RecordAllocation(mappedBytes);
     }
-    return (lPi * inAngle / 180);
+#else // ! MAC_OR_LINUX_
+    result = AllocateAligned(numBytes, (useHugePages ? kHugePageSize : kPageAlignment));
+    if (result)
+    {
+        RecordAllocation(numBytes);
+    }
+#endif // ! MAC_OR_LINUX_
+    return result;
+} // Scuddle::AllocatePages
+
+realType
+Scuddle::DegreesToRadians(const realType inAngle)
+{
+    return (getPi() * inAngle / 180);
 } // Scuddle::DegreesToRadians
 
 int
@@ -356,12 +451,7 @@ Scuddle::MapWeightToReal(const WeightQuality aValue)
 realType
 Scuddle::RadiansToDegrees(const realType inAngle)
 {
-    if (! lPiSet)
-    {
-        lPi = (4 * static_cast<realType>(atan2(1, 1)));
-        lPiSet = true;
-    }
-    return (180 * inAngle / lPi);
+    return (180 * inAngle / getPi());
 } // Scuddle::RadiansToDegrees
 
 realType
@@ -372,22 +462,48 @@ Scuddle::RandomAngle(const realType maxAngle)
 
 realType
 Scuddle::RandRealInRange(const realType lowValue,
-                                  const realType highValue)
+                         const realType highValue)
 {
-    realType randNumb;
-
-    initRandom();
-    randNumb = (static_cast<realType>(rand() % kModulus) / (kModulus - 1));
-    return (lowValue + (randNumb * (highValue - lowValue)));
+    return GetThreadRandomGenerator().nextReal(lowValue, highValue);
 } // Scuddle::RandRealInRange
 
 size_t
 Scuddle::RandUnsignedInRange(const size_t highValue)
 {
-    initRandom();
-    return static_cast<size_t>(static_cast<size_t>(rand() / kModulus) % (highValue + 1));
+    return GetThreadRandomGenerator().nextUnsigned(highValue);
 } // Scuddle::RandUnsignedInRange
 
+void
+Scuddle::ReleaseAligned(void * block)
+{
+#if MAC_OR_LINUX_
+    RecordBlockRelease(block);
+    free(block);
+#else // ! MAC_OR_LINUX_
+    _aligned_free(block);
+#endif // ! MAC_OR_LINUX_
+} // Scuddle::ReleaseAligned
+
+void
+Scuddle::ReleasePages(void *       block,
+                      const size_t numBytes,
+                      const bool   useHugePages)
+{
+    if (block)
+    {
+#if MAC_OR_LINUX_
+        size_t mappedBytes = getMappedSize(numBytes, useHugePages);
+        
+        RecordRelease(mappedBytes);
+        munmap(block, mappedBytes);
+#else // ! MAC_OR_LINUX_
+        static_cast<void>(useHugePages);
+        RecordRelease(numBytes);
+        ReleaseAligned(block);
+#endif // ! MAC_OR_LINUX_
+    }
+} // Scuddle::ReleasePages
+
 bool
 Scuddle::ReallyClose(const realType firstValue,
                           const realType secondValue)
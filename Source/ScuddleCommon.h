@@ -40,6 +40,7 @@
 # define Scuddle_Common_H_ /* Header guard */
 
 # include "ScuddleDataTypes.h"
+# include "ScuddleRandomGenerator.h"
 
 # include <limits>
 # include <vector>
@@ -60,7 +61,32 @@
 
 namespace Scuddle
 {
+    
+    /*! @brief The size of a huge page, in bytes. */
+    static const size_t kHugePageSize = (2 * 1024 * 1024);
+
+    /*! @brief Allocate a block of memory with a specific alignment.
+     @param numBytes The size of the block, in bytes.
+     @param alignment The required alignment, in bytes; must be a power of two.
+     @returns The allocated block, or @c nullptr if the block could not be allocated. */
+    void *
+    AllocateAligned(const size_t numBytes,
+                    const size_t alignment);
 
+    /*! @brief Allocate a block of whole pages of memory.
+     
+     The block is obtained directly from the operating system, rather than from the heap, so that
+     large blocks do not fragment the heap. When huge pages are requested, the block is aligned and
+     sized to a multiple of the huge page size and the operating system is advised to back it with
+     huge pages, which reduces the pressure on the translation lookaside buffer when a large block
+     is walked repeatedly.
+     @param numBytes The size of the block, in bytes.
+     @param useHugePages @c true if the block should be backed by huge pages, where available.
+     @returns The allocated block, or @c nullptr if the block could not be allocated. */
+    void *
+    AllocatePages(const size_t numBytes,
+                  const bool   useHugePages);
+    
     /*! @brief Convert an angle in degrees to radians.
      @param inAngle The angle specified in degrees.
      @returns The angle as radians. */
@@ -154,12 +180,16 @@ namespace Scuddle
     RadiansToDegrees(const realType inAngle);
 
     /*! @brief Return a uniformly distributed random angle in the range 0..maxAngle, as radians.
+     
+     The value is taken from the random number generator for the calling thread.
      @param maxAngle The upper bound for the output, in degrees.
      @returns A uniformly distributed random angle in the range 0..maxAngle. */
     realType
     RandomAngle(const realType maxAngle);
     
     /*! @brief Return a uniformly distributed random number in the range lowValue..highValue.
+     
+     The value is taken from the random number generator for the calling thread.
      @param lowValue The lower bound for the output.
      @param highValue The upper bound for the output.
      @returns A uniformly distributed random number in the range lowValue..highValue. */
@@ -168,11 +198,27 @@ namespace Scuddle
                     const realType highValue);
 
     /*! @brief Return a uniformly distributed random number in the range 0..highValue.
+     
+     The value is taken from the random number generator for the calling thread.
      @param highValue The upper bound for the output.
      @returns A uniformly distributed random number in the range 0..highValue. */
     size_t
     RandUnsignedInRange(const size_t highValue);
 
+    /*! @brief Release a block of memory that was allocated with AllocateAligned.
+     @param block The block to be released. */
+    void
+    ReleaseAligned(void * block);
+
+    /*! @brief Release a block of memory that was allocated with AllocatePages.
+     @param block The block to be released.
+     @param numBytes The size of the block, in bytes, as passed to AllocatePages.
+     @param useHugePages The value passed to AllocatePages. */
+    void
+    ReleasePages(void *       block,
+                 const size_t numBytes,
+                 const bool   useHugePages);
+    
     /*! @brief Compare two floating-point numbers and determine if they are very close in value.
      @param firstValue The first value to compare.
      @param secondValue The second value to compare.
@@ -0,0 +1,101 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleCrossoverPolicies.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The policy classes for choosing the number of attributes swapped in a crossover.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_CrossoverPolicies_H_))
+# define Scuddle_CrossoverPolicies_H_ /* Header guard */
+
+# include "ScuddleEvolverBase.h"
+
+# include <algorithm>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The policy classes for choosing the number of attributes swapped in a crossover. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief The crossover policy that swaps a fixed number of attributes, as given by the
+     @c crossoverCount parameter of the engine. */
+    class CrossoverByCount
+    {
+    public :
+        
+        /*! @brief Return the number of attributes to swap between two children.
+         @param engine The engine that is producing the children.
+         @param numAttributes The number of attributes in each child.
+         @returns The number of attributes to swap. */
+        static size_t
+        getSwapCount(const EvolverBase & engine,
+                     const size_t        numAttributes)
+        {
+            return std::min(engine.crossoverCount.getValue(), numAttributes);
+        } // getSwapCount
+        
+    }; // CrossoverByCount
+    
+    /*! @brief The crossover policy that swaps a fraction of the attributes, as given by the
+     @c crossoverFraction parameter of the engine. */
+    class CrossoverByFraction
+    {
+    public :
+        
+        /*! @brief Return the number of attributes to swap between two children.
+         @param engine The engine that is producing the children.
+         @param numAttributes The number of attributes in each child.
+         @returns The number of attributes to swap. */
+        static size_t
+        getSwapCount(const EvolverBase & engine,
+                     const size_t        numAttributes)
+        {
+            return static_cast<size_t>(numAttributes * engine.crossoverFraction.getValue());
+        } // getSwapCount
+        
+    }; // CrossoverByFraction
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_CrossoverPolicies_H_) */
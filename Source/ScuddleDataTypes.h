@@ -46,10 +46,6 @@
 #  define MAC_OR_LINUX_ (defined(__APPLE__) || defined(__linux__))
 # endif // ! defined(MAC_OR_LINUX_)
 
-# define USE_SKELETON_ /* Use Skeleton rather than Body. */
-//# define GENERATE_POSITIONS_ /* Generate coordinates as well as angles. */
-//# define USE_FRACTION_FOR_CROSSOVER_ /* Use a fraction for crossovers. */
-
 namespace Scuddle
 {
     /*! @brief Flow Effort Qualities. */
@@ -119,12 +115,8 @@ namespace Scuddle
     /*! @brief The floating-point data type to use. */
     typedef float realType;
 
-# if (! defined(USE_SKELETON_))
-#  if defined(GENERATE_POSITIONS_)
     /*! @brief The two-dimensional coordinate data type. */
     typedef std::complex<realType> Coordinate2D;
-#  endif // defined(GENERATE_POSITIONS_)
-# endif // ! defined(USE_SKELETON_)
 
     /*! @brief The generalized constrained value class template. */
     template<typename Type> class ConstrainedValue
@@ -0,0 +1,443 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleEvolver.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for Evolver objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleEvolver.h"
+
+#include <atomic>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for Evolver objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The state of a fitness calculation that is shared by the fitness threads. */
+struct FitnessPass
+{
+    /*! @brief The cache of fitness factors, or @c nullptr if there is no cache. */
+    FitnessCache *      cache;
+    
+    /*! @brief The fitness coefficients to be applied. */
+    FitnessCoefficients coefficients;
+    
+    /*! @brief The number of objects whose fitness was not calculated. */
+    std::atomic<size_t> numSkipped;
+    
+}; // FitnessPass
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add the angles of an object that has indexed angles to a summary of the population.
+ @param statistics The summary to be added to.
+ @param anObject The object whose angles are to be added. */
+template <typename Genome>
+static void
+addIndexedAngles(PopulationStatistics & statistics,
+                 const Genome &         anObject)
+{
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        statistics.addAngle(ii, anObject.getAngle(ii));
+    }
+} // addIndexedAngles
+
+/*! @brief Add the angles of an object to a summary of the population.
+ @param statistics The summary to be added to.
+ @param anObject The object whose angles are to be added. */
+static void
+addAngles(PopulationStatistics & statistics,
+          const BinarySkeleton & anObject)
+{
+    addIndexedAngles(statistics, anObject);
+} // addAngles
+
+/*! @brief Add the angles of an object to a summary of the population.
+ 
+ The angles are added with the index of the matching Skeleton angle.
+ @param statistics The summary to be added to.
+ @param anObject The object whose angles are to be added. */
+static void
+addAngles(PopulationStatistics & statistics,
+          const Body &           anObject)
+{
+    statistics.addAngle(Skeleton::kLeftHipToKnee, anObject.getLeftHipToKneeAngle());
+    statistics.addAngle(Skeleton::kLeftKneeToFoot, anObject.getLeftKneeToFootAngle());
+    statistics.addAngle(Skeleton::kRightHipToKnee, anObject.getRightHipToKneeAngle());
+    statistics.addAngle(Skeleton::kRightKneeToFoot, anObject.getRightKneeToFootAngle());
+    statistics.addAngle(Skeleton::kLeftShoulderToElbow, anObject.getLeftShoulderToElbowAngle());
+    statistics.addAngle(Skeleton::kLeftElbowToWrist, anObject.getLeftElbowToWristAngle());
+    statistics.addAngle(Skeleton::kRightShoulderToElbow,
+                        anObject.getRightShoulderToElbowAngle());
+    statistics.addAngle(Skeleton::kRightElbowToWrist, anObject.getRightElbowToWristAngle());
+} // addAngles
+
+/*! @brief Add the angles of an object to a summary of the population.
+ @param statistics The summary to be added to.
+ @param anObject The object whose angles are to be added. */
+static void
+addAngles(PopulationStatistics & statistics,
+          const PackedSkeleton & anObject)
+{
+    addIndexedAngles(statistics, anObject);
+} // addAngles
+
+/*! @brief Add the angles of an object to a summary of the population.
+ @param statistics The summary to be added to.
+ @param anObject The object whose angles are to be added. */
+static void
+addAngles(PopulationStatistics & statistics,
+          const Skeleton &       anObject)
+{
+    addIndexedAngles(statistics, anObject);
+} // addAngles
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+template <typename Genome,
+          typename CrossoverPolicy>
+Evolver<Genome, CrossoverPolicy>::Evolver(void) :
+    inherited()
+{
+} // Evolver::Evolver
+
+template <typename Genome,
+          typename CrossoverPolicy>
+Evolver<Genome, CrossoverPolicy>::Evolver(const uint64_t seed) :
+    inherited(seed)
+{
+} // Evolver::Evolver
+
+template <typename Genome,
+          typename CrossoverPolicy>
+Evolver<Genome, CrossoverPolicy>::~Evolver(void)
+{
+} // Evolver::~Evolver
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::calculateFitnessValues(void)
+{
+    FitnessPass pass;
+    
+    pass.cache = getFitnessCache();
+    pass.numSkipped = 0;
+    fitnessProfile.getCoefficients(pass.coefficients);
+    // Each object only reads the fitness coefficients and its own attributes, so the objects can
+    // be shared among the fitness threads, which all read the one copy of the coefficients. The
+    // task refers to the pass rather than copying it, as forEachRange returns only when every
+    // range is done; this keeps the task small enough to be held without a heap allocation.
+    forEachRange(_population.size(), [this, &pass] (const size_t first,
+                                                    const size_t last)
+                 {
+                     FitnessCache *              cache = pass.cache;
+                     const FitnessCoefficients & coefficients = pass.coefficients;
+                     size_t                      skippedInRange = 0;
+                     
+                     for (size_t ii = first; last > ii; ++ii)
+                     {
+                         Individual & anObject = _population[ii];
+                         
+                         if (cache)
+                         {
+                             uint64_t       key = anObject.getAttributeHash();
+                             FitnessFactors factors;
+                             
+                             if (cache->find(key, factors))
+                             {
+                                 anObject.setFitnessFactors(factors);
+                                 anObject.rescoreFitness(coefficients);
+                                 ++skippedInRange;
+                             }
+                             else
+                             {
+                                 if (! anObject.updateFitness(coefficients))
+                                 {
+                                     ++skippedInRange;
+                                 }
+                                 cache->insert(key, anObject.getFitnessFactors());
+                             }
+                         }
+                         else if (! anObject.updateFitness(coefficients))
+                         {
+                             ++skippedInRange;
+                         }
+                     }
+                     pass.numSkipped += skippedInRange;
+                 });
+    recordEvaluations(_population.size(), pass.numSkipped);
+} // Evolver::calculateFitnessValues
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::collectStatistics(PopulationStatistics & statistics)
+{
+    for (typename Population::const_iterator walker(_population.begin());
+         _population.end() != walker; ++walker)
+    {
+        statistics.addScore(walker->getFitnessScore());
+        statistics.addFactors(walker->getFitnessFactors());
+        addAngles(statistics, *walker);
+    }
+} // Evolver::collectStatistics
+
+template <typename Genome,
+          typename CrossoverPolicy>
+typename Evolver<Genome, CrossoverPolicy>::Individual &
+Evolver<Genome, CrossoverPolicy>::copyIntoNextGeneration(const size_t       index,
+                                                         const Individual & original)
+{
+    if (_nextGeneration.size() > index)
+    {
+        _nextGeneration[index] = original;
+    }
+    else
+    {
+        _nextGeneration.push_back(original);
+    }
+    return _nextGeneration[index];
+} // Evolver::copyIntoNextGeneration
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::doCrossovers(void)
+{
+    // The selected parents are carried forward into the next generation, and we create two new
+    // 'children' for each parent pair directly after them; then the generations are exchanged,
+    // so that the storage of the previous generation is reused for the one after.
+    size_t targetSize = populationSize.getValue();
+    size_t nextSize = 0;
+    size_t numSwap = CrossoverPolicy::getSwapCount(*this, Individual::kNumAttributes);
+    
+    // The children are referred to while their siblings are added, so the next generation must
+    // not move; leave room for the extra child when the population size is odd.
+    _nextGeneration.reserve(targetSize + 1);
+    for (IndividualIndexVector::const_iterator walker(_selection.begin());
+         _selection.end() != walker; ++walker)
+    {
+        copyIntoNextGeneration(nextSize++, _population[*walker]);
+    }
+    while (targetSize > nextSize)
+    {
+        // Pick two 'parent' objects:
+        size_t firstChoice = randUnsignedInRange(nextSize - 1);
+        size_t secondChoice;
+        
+        for ( ; ; )
+        {
+            secondChoice = randUnsignedInRange(nextSize - 1);
+            if (firstChoice != secondChoice)
+            {
+                break;
+            }
+            
+        }
+        // Crossover attributes:
+        Individual & firstChild = copyIntoNextGeneration(nextSize++,
+                                                         _nextGeneration[firstChoice]);
+        Individual & secondChild = copyIntoNextGeneration(nextSize++,
+                                                          _nextGeneration[secondChoice]);
+        
+        firstChild.swapValues(secondChild, numSwap, getGenerator());
+    }
+    // Drop any objects that are not needed in this generation.
+    _nextGeneration.erase(_nextGeneration.begin() + nextSize, _nextGeneration.end());
+    _population.swap(_nextGeneration);
+    // The parents are now at the start of the population.
+    for (size_t ii = 0, imax = _selection.size(); imax > ii; ++ii)
+    {
+        _selection[ii] = ii;
+    }
+} // Evolver::doCrossovers
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::doMutations(void)
+{
+    // Mark the objects to be mutated:
+    for (size_t ii = 0, jmax = _population.size(),
+         imax = static_cast<size_t>(mutationFraction.getValue() * jmax); imax > ii; )
+    {
+        Individual & anIndividual = _population[randUnsignedInRange(jmax - 1)];
+        
+        if (! anIndividual.isMarked())
+        {
+            anIndividual.setMark();
+            ++ii;
+        }
+    }
+    for (typename Population::iterator walker(_population.begin());
+         _population.end() != walker; ++walker)
+    {
+        if (walker->isMarked())
+        {
+            walker->mutate(getGenerator());
+            walker->clearMark();
+        }
+    }
+} // Evolver::doMutations
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::init(void)
+{
+    // Each individual draws from its own stream, so that the initial population only depends on
+    // the seed of the engine.
+    uint64_t initSeed = getGenerator().next();
+    size_t   numIndividuals = populationSize.getValue();
+    
+    _population.clear();
+    _nextGeneration.clear();
+    _selection.clear();
+    // Leave room for the extra child when the population size is odd.
+    _population.reserve(numIndividuals + 1);
+    _nextGeneration.reserve(numIndividuals + 1);
+    for (size_t ii = 0; numIndividuals > ii; ++ii)
+    {
+        RandomGenerator individualGenerator(initSeed, ii);
+        
+        _population.emplace_back(individualGenerator);
+    }
+    resetGeneration();
+} // Evolver::init
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::loadWheel(void)
+{
+    _scores.resize(_population.size());
+    for (size_t ii = 0, imax = _population.size(); imax > ii; ++ii)
+    {
+        _scores[ii] = _population[ii].getFitnessScore();
+    }
+    _wheel.build(_scores.data(), _scores.size());
+} // Evolver::loadWheel
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::makeFinalSelection(const size_t selectionSize)
+{
+    loadWheel();
+    _wheel.pickUniversal(selectionSize, getGenerator(), _selection);
+} // Evolver::makeFinalSelection
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::makeSelection(void)
+{
+    loadWheel();
+    _wheel.pickWithoutReplacement(getParentCount(_population.size()), getGenerator(), _selection);
+} // Evolver::makeSelection
+
+template <typename Genome,
+          typename CrossoverPolicy>
+void
+Evolver<Genome, CrossoverPolicy>::rescoreFitnessValues(void)
+{
+    FitnessCoefficients coefficients;
+    
+    fitnessProfile.getCoefficients(coefficients);
+    // The fitness factors of the objects are current, so only the coefficients are applied; the
+    // coefficients are referred to rather than copied, as for calculateFitnessValues.
+    forEachRange(_population.size(), [this, &coefficients] (const size_t first,
+                                                            const size_t last)
+                 {
+                     for (size_t ii = first; last > ii; ++ii)
+                     {
+                         _population[ii].rescoreFitness(coefficients);
+                     }
+                 });
+} // Evolver::rescoreFitnessValues
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Template instantiations
+#endif // defined(__APPLE__)
+
+template class Scuddle::Evolver<BinarySkeleton, CrossoverByCount>;
+template class Scuddle::Evolver<BinarySkeleton, CrossoverByFraction>;
+template class Scuddle::Evolver<Body, CrossoverByCount>;
+template class Scuddle::Evolver<Body, CrossoverByFraction>;
+template class Scuddle::Evolver<PackedSkeleton, CrossoverByCount>;
+template class Scuddle::Evolver<PackedSkeleton, CrossoverByFraction>;
+template class Scuddle::Evolver<PositionedBody, CrossoverByCount>;
+template class Scuddle::Evolver<PositionedBody, CrossoverByFraction>;
+template class Scuddle::Evolver<Skeleton, CrossoverByCount>;
+template class Scuddle::Evolver<Skeleton, CrossoverByFraction>;
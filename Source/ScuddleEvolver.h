@@ -0,0 +1,213 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleEvolver.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for Evolver objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_Evolver_H_))
+# define Scuddle_Evolver_H_ /* Header guard */
+
+# include "ScuddleBinarySkeleton.h"
+# include "ScuddleCrossoverPolicies.h"
+# include "ScuddlePackedSkeleton.h"
+# include "ScuddleEvolverBase.h"
+# include "ScuddlePageAllocator.h"
+# include "ScuddlePositionedBody.h"
+# include "ScuddleRouletteWheel.h"
+# include "ScuddleSkeleton.h"
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for Evolver objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief A sequence of indices of objects within a population. */
+    typedef std::vector<size_t> IndividualIndexVector;
+    
+    /*! @brief The Scuddle Evolver engine, which works on a set of individual objects.
+     
+     The choices that shape an engine are template policies, so that every call on an object is
+     resolved at compile time: @c Genome is the type of object that is evolved - Skeleton,
+     BinarySkeleton, PackedSkeleton, Body or PositionedBody, which also generates joint
+     positions - and @c CrossoverPolicy, either
+     CrossoverByCount or CrossoverByFraction, gives the number of attributes to swap. Each
+     combination is instantiated in ScuddleEvolver.cpp. */
+    template <typename Genome,
+              typename CrossoverPolicy>
+    class Evolver : public EvolverBase
+    {
+    public :
+        
+        /*! @brief The type of object that is evolved. */
+        typedef Genome Individual;
+        
+        /*! @brief A set of objects that are evolved, held by value in contiguous storage. */
+        typedef std::vector<Individual, PageAllocator<Individual> > Population;
+        
+        /*! @brief The constructor.
+         
+         The random number generator is seeded from the system entropy source. */
+        Evolver(void);
+        
+        /*! @brief The constructor.
+         @param seed The seed for the random number generator. */
+        explicit
+        Evolver(const uint64_t seed);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~Evolver(void);
+        
+        /*! @brief Return the current set of objects.
+         @returns The current set of objects. */
+        const Population &
+        getPopulation(void)
+        const
+        {
+            return _population;
+        } // getPopulation
+        
+        /*! @brief Return the indices of the most recently selected set of objects.
+         @returns The indices of the most recently selected set of objects. */
+        const IndividualIndexVector &
+        getSelection(void)
+        const
+        {
+            return _selection;
+        } // getSelection
+        
+        /*! @brief Discard any existing objects and create a new population. */
+        virtual void
+        init(void);
+        
+    protected :
+        
+        /*! @brief Update the fitness value for the objects. */
+        virtual void
+        calculateFitnessValues(void);
+        
+        /*! @brief Add each of the objects to a summary of the population.
+         @param statistics The summary to be added to. */
+        virtual void
+        collectStatistics(PopulationStatistics & statistics);
+        
+        /*! @brief Generate a new set of objects, using the selected parents. */
+        virtual void
+        doCrossovers(void);
+        
+        /*! @brief Mutate some of the objects. */
+        virtual void
+        doMutations(void);
+        
+        /*! @brief Make the final selections.
+         @param selectionSize The number of objects to be selected. */
+        virtual void
+        makeFinalSelection(const size_t selectionSize);
+        
+        /*! @brief Make the selections for this iteration. */
+        virtual void
+        makeSelection(void);
+        
+        /*! @brief Apply the current fitness coefficients to the fitness factors of the objects. */
+        virtual void
+        rescoreFitnessValues(void);
+        
+    private :
+        
+        /*! @brief The class that this class is derived from. */
+        typedef EvolverBase inherited;
+        
+        /*! @brief Copy an object into a position in the next generation.
+         
+         The object already at that position is overwritten; the next generation only grows when
+         the position is past its end.
+         @param index The position in the next generation.
+         @param original The object to be copied.
+         @returns The copy of the object. */
+        Individual &
+        copyIntoNextGeneration(const size_t       index,
+                               const Individual & original);
+        
+        /*! @brief Set up the roulette wheel with the current fitness values. */
+        void
+        loadWheel(void);
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The set of objects that are worked on. */
+        Population _population;
+        
+        /*! @brief The objects for the next generation, which are exchanged with the current
+         generation after the crossovers. */
+        Population _nextGeneration;
+        
+        /*! @brief The indices of the objects that have been selected. */
+        IndividualIndexVector _selection;
+        
+        /*! @brief The fitness values of the objects, in population order. */
+        std::vector<realType> _scores;
+        
+        /*! @brief The roulette wheel used to make selections. */
+        RouletteWheel _wheel;
+        
+    }; // Evolver
+    
+    extern template class Evolver<BinarySkeleton, CrossoverByCount>;
+    extern template class Evolver<BinarySkeleton, CrossoverByFraction>;
+    extern template class Evolver<Body, CrossoverByCount>;
+    extern template class Evolver<Body, CrossoverByFraction>;
+    extern template class Evolver<PackedSkeleton, CrossoverByCount>;
+    extern template class Evolver<PackedSkeleton, CrossoverByFraction>;
+    extern template class Evolver<PositionedBody, CrossoverByCount>;
+    extern template class Evolver<PositionedBody, CrossoverByFraction>;
+    extern template class Evolver<Skeleton, CrossoverByCount>;
+    extern template class Evolver<Skeleton, CrossoverByFraction>;
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_Evolver_H_) */
@@ -0,0 +1,540 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleEvolverBase.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for the common part of the Evolver objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleEvolverBase.h"
+
+#include <algorithm>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the common part of the Evolver objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The initial number of attributes to swap. */
+static const size_t kInitialCrossoverCount = 2;
+
+/*! @brief The initial fraction of attributes to swap. */
+static const realType kInitialCrossoverFraction = static_cast<realType>(0.50);
+
+/*! @brief The initial fraction of the set of objects that are to be mutated. */
+static const realType kInitialMutationFraction = static_cast<realType>(0.10);
+
+/*! @brief The initial number of objects to generate. */
+static const size_t kInitialPopulationSize = 200;
+
+/*! @brief The initial fraction of the set of objects that are selected. */
+static const realType kInitialSelectionFraction = static_cast<realType>(0.20);
+
+/*! @brief The maximum number of attributes to swap. */
+static const size_t kMaximumCrossoverCount = 13;
+
+/*! @brief The maximum fraction of attributes to swap. */
+static const realType kMaximumCrossoverFraction = static_cast<realType>(1);
+
+/*! @brief The maximum fraction of the set of objects that are to be mutated. */
+static const realType kMaximumMutationFraction = static_cast<realType>(1);
+
+/*! @brief The maximum number of objects to generate. */
+static const size_t kMaximumPopulationSize = std::numeric_limits<size_t>::max();
+
+/*! @brief The maximum fraction of the set of objects that are selected. */
+static const realType kMaximumSelectionFraction = static_cast<realType>(1);
+
+/*! @brief The minimum number of attributes to swap. */
+static const size_t kMinimumCrossoverCount = 0;
+
+/*! @brief The minimum fraction of attributes to swap. */
+static const realType kMinimumCrossoverFraction = static_cast<realType>(0);
+
+/*! @brief The minimum fraction of the set of objects that are to be mutated. */
+static const realType kMinimumMutationFraction = static_cast<realType>(0);
+
+/*! @brief The minimum number of objects to generate. */
+static const size_t kMinimumPopulationSize = 2;
+
+/*! @brief The minimum fraction of the set of objects that are selected. */
+static const realType kMinimumSelectionFraction = static_cast<realType>(0);
+
+/*! @brief The smallest number of parents that can produce children. */
+static const size_t kMinimumParentCount = 2;
+
+/*! @brief The names of the phases in trace events, named for the methods that do the work. */
+static const char * kPhaseTraceNames[] =
+{
+    "calculateFitnessValues",
+    "collectStatistics",
+    "makeSelection",
+    "doCrossovers",
+    "doMutations",
+    "makeFinalSelection",
+    "step"
+};
+
+static_assert((sizeof(kPhaseTraceNames) / sizeof(*kPhaseTraceNames)) == kNumEnginePhases,
+              "There must be a trace name for each phase");
+
+/*! @brief The name of the work done by each thread in a shared range of objects. */
+static const char * kRangeTraceName = "forEachRange";
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+EvolverBase::EvolverBase(void) :
+    crossoverCount(kMinimumCrossoverCount, kMaximumCrossoverCount, kInitialCrossoverCount),
+    crossoverFraction(kMinimumCrossoverFraction, kMaximumCrossoverFraction,
+                      kInitialCrossoverFraction),
+    mutationFraction(kMinimumMutationFraction, kMaximumMutationFraction, kInitialMutationFraction),
+    populationSize(kMinimumPopulationSize, kMaximumPopulationSize, kInitialPopulationSize),
+    selectionFraction(kMinimumSelectionFraction, kMaximumSelectionFraction,
+                      kInitialSelectionFraction), _workers(nullptr), _fitnessCache(nullptr),
+    _counters(nullptr), _populationStatistics(nullptr), _profilePublisher(nullptr),
+    _generation(0), _numEvaluations(0), _numSkippedEvaluations(0),
+    _traceSourceId(NewTraceSourceId()), _profileVersion(0), _allocationAccountingEnabled(false),
+    _fitnessValuesCurrent(false), _instrumentationEnabled(false)
+{
+} // EvolverBase::EvolverBase
+
+EvolverBase::EvolverBase(const uint64_t seed) :
+    crossoverCount(kMinimumCrossoverCount, kMaximumCrossoverCount, kInitialCrossoverCount),
+    crossoverFraction(kMinimumCrossoverFraction, kMaximumCrossoverFraction,
+                      kInitialCrossoverFraction),
+    mutationFraction(kMinimumMutationFraction, kMaximumMutationFraction, kInitialMutationFraction),
+    populationSize(kMinimumPopulationSize, kMaximumPopulationSize, kInitialPopulationSize),
+    selectionFraction(kMinimumSelectionFraction, kMaximumSelectionFraction,
+                      kInitialSelectionFraction), _generator(seed), _workers(nullptr),
+    _fitnessCache(nullptr), _counters(nullptr), _populationStatistics(nullptr),
+    _profilePublisher(nullptr), _generation(0), _numEvaluations(0), _numSkippedEvaluations(0),
+    _traceSourceId(NewTraceSourceId()), _profileVersion(0), _allocationAccountingEnabled(false),
+    _fitnessValuesCurrent(false), _instrumentationEnabled(false)
+{
+} // EvolverBase::EvolverBase
+
+EvolverBase::~EvolverBase(void)
+{
+    delete _workers;
+    delete _counters;
+    delete _populationStatistics;
+    if (_allocationAccountingEnabled)
+    {
+        StopAllocationAccounting();
+    }
+} // EvolverBase::~EvolverBase
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+EvolverBase::finalSelection(const size_t selectionSize)
+{
+    PhaseStatistics::Clock::time_point startTime = startPhase();
+    bool                               calculating = (! _fitnessValuesCurrent);
+    
+    startSamples();
+    rescore();
+    // Only a calculation of the fitness values records evaluations, so a rescoring with new
+    // coefficients is counted as part of the final selection rather than as a fitness phase.
+    if (calculating)
+    {
+        startTime = finishPhase(kPhaseFitness, startTime);
+    }
+    makeFinalSelection(selectionSize);
+    finishPhase(kPhaseFinalSelection, startTime);
+    finishSamples(true);
+} // EvolverBase::finalSelection
+
+void
+EvolverBase::finishSamples(const bool finalSelection)
+{
+    if (_allocationAccountingEnabled)
+    {
+        AllocationCounts & total = _allocationSample.phases[kPhaseGeneration];
+        int64_t            netBytes = 0;
+        
+        _allocationSample.finalSelection = finalSelection;
+        _allocationSample.statistics = ((! finalSelection) && _populationStatistics);
+        total = AllocationCounts();
+        for (size_t ii = 0; kPhaseGeneration > ii; ++ii)
+        {
+            const AllocationCounts & counts = _allocationSample.phases[ii];
+            
+            total.allocations += counts.allocations;
+            total.releases += counts.releases;
+            total.allocatedBytes += counts.allocatedBytes;
+            // The peak of each phase is relative to the net bytes at its start.
+            total.peakNetBytes = std::max(total.peakNetBytes, netBytes + counts.peakNetBytes);
+            netBytes += counts.netBytes;
+        }
+        total.netBytes = netBytes;
+        _allocationSamples.push_back(_allocationSample);
+    }
+    if (_counters)
+    {
+        CounterValues & total = _counterSample.phases[kPhaseGeneration];
+        
+        _counterSample.finalSelection = finalSelection;
+        _counterSample.statistics = ((! finalSelection) && _populationStatistics);
+        total.fill(0);
+        for (size_t ii = 0; kPhaseGeneration > ii; ++ii)
+        {
+            for (size_t jj = 0; kNumPerformanceCounters > jj; ++jj)
+            {
+                total[jj] += _counterSample.phases[ii][jj];
+            }
+        }
+        _counterSamples.push_back(_counterSample);
+    }
+} // EvolverBase::finishSamples
+
+PhaseStatistics::Clock::time_point
+EvolverBase::finishPhase(const EnginePhase                          phase,
+                         const PhaseStatistics::Clock::time_point & startTime)
+{
+    PhaseStatistics::Clock::time_point result;
+    bool                               tracing = IsTracingEnabled();
+    
+    if (_instrumentationEnabled || tracing)
+    {
+        result = PhaseStatistics::Clock::now();
+        // A phase that started before timing was enabled has no start time, and is not recorded.
+        if (PhaseStatistics::Clock::time_point() != startTime)
+        {
+            if (_instrumentationEnabled)
+            {
+                _phaseStatistics.record(phase, result - startTime);
+            }
+            if (tracing)
+            {
+                RecordTraceEvent(kPhaseTraceNames[phase], _traceSourceId, startTime, result);
+            }
+        }
+    }
+    if (_counters && (kPhaseGeneration != phase))
+    {
+        CounterReadings phaseFinishCounters;
+        
+        _counters->read(phaseFinishCounters);
+        PerformanceCounters::CalculateChanges(_phaseStartCounters, phaseFinishCounters,
+                                              _counterSample.phases[phase]);
+        _phaseStartCounters = phaseFinishCounters;
+    }
+    if (_allocationAccountingEnabled && (kPhaseGeneration != phase))
+    {
+        AllocationCounts   phaseFinishAllocations;
+        AllocationCounts & counts = _allocationSample.phases[phase];
+        
+        ReadAllocationCounts(phaseFinishAllocations);
+        counts.allocations = (phaseFinishAllocations.allocations -
+                              _phaseStartAllocations.allocations);
+        counts.releases = (phaseFinishAllocations.releases - _phaseStartAllocations.releases);
+        counts.allocatedBytes = (phaseFinishAllocations.allocatedBytes -
+                                 _phaseStartAllocations.allocatedBytes);
+        counts.netBytes = (phaseFinishAllocations.netBytes - _phaseStartAllocations.netBytes);
+        counts.peakNetBytes = (phaseFinishAllocations.peakNetBytes -
+                               _phaseStartAllocations.netBytes);
+        ResetAllocationPeak();
+        _phaseStartAllocations = phaseFinishAllocations;
+    }
+    return result;
+} // EvolverBase::finishPhase
+
+void
+EvolverBase::forEachRange(const size_t                  numObjects,
+                          const WorkerPool::RangeTask & task)
+{
+    if (_workers)
+    {
+        if (IsTracingEnabled())
+        {
+            uint32_t sourceId = _traceSourceId;
+            
+            _workers->run(numObjects, 0, [&task, sourceId] (const size_t first,
+                                                            const size_t last)
+                          {
+                              TraceClock::time_point startTime = TraceClock::now();
+                              
+                              task(first, last);
+                              RecordTraceEvent(kRangeTraceName, sourceId, startTime,
+                                               TraceClock::now());
+                          });
+        }
+        else
+        {
+            _workers->run(numObjects, 0, task);
+        }
+    }
+    else if (0 < numObjects)
+    {
+        task(0, numObjects);
+    }
+} // EvolverBase::forEachRange
+
+size_t
+EvolverBase::getParentCount(const size_t numObjects)
+const
+{
+    size_t result = static_cast<size_t>(numObjects * selectionFraction.getValue());
+    
+    if (kMinimumParentCount > result)
+    {
+        result = kMinimumParentCount;
+    }
+    return result;
+} // EvolverBase::getParentCount
+
+double
+EvolverBase::getSkippedEvaluationRatio(void)
+const
+{
+    double result;
+    
+    if (0 < _numEvaluations)
+    {
+        result = (static_cast<double>(_numSkippedEvaluations) / _numEvaluations);
+    }
+    else
+    {
+        result = 0;
+    }
+    return result;
+} // EvolverBase::getSkippedEvaluationRatio
+
+size_t
+EvolverBase::getWorkerCount(void)
+const
+{
+    return (_workers ? _workers->getThreadCount() : 1);
+} // EvolverBase::getWorkerCount
+
+realType
+EvolverBase::randRealInRange(const realType lowValue,
+                             const realType highValue)
+{
+    return _generator.nextReal(lowValue, highValue);
+} // EvolverBase::randRealInRange
+
+size_t
+EvolverBase::randUnsignedInRange(const size_t highValue)
+{
+    return _generator.nextUnsigned(highValue);
+} // EvolverBase::randUnsignedInRange
+
+void
+EvolverBase::rescore(void)
+{
+    applyPublishedProfile();
+    if (_fitnessValuesCurrent)
+    {
+        rescoreFitnessValues();
+    }
+    else
+    {
+        calculateFitnessValues();
+        _fitnessValuesCurrent = true;
+    }
+} // EvolverBase::rescore
+
+void
+EvolverBase::setAllocationAccountingEnabled(const bool enabled)
+{
+    if (enabled)
+    {
+        if (! _allocationAccountingEnabled)
+        {
+            StartAllocationAccounting();
+        }
+        _allocationSamples.clear();
+    }
+    else if (_allocationAccountingEnabled)
+    {
+        StopAllocationAccounting();
+    }
+    _allocationAccountingEnabled = enabled;
+} // EvolverBase::setAllocationAccountingEnabled
+
+bool
+EvolverBase::setPerformanceCountersEnabled(const bool enabled)
+{
+    bool result = true;
+    
+    delete _counters;
+    _counters = nullptr;
+    _counterSamples.clear();
+    if (enabled)
+    {
+        _counters = new PerformanceCounters;
+        result = _counters->isAvailable();
+        if (! result)
+        {
+            // Nothing can be counted, so there is no point reading the counters.
+            delete _counters;
+            _counters = nullptr;
+        }
+    }
+    return result;
+} // EvolverBase::setPerformanceCountersEnabled
+
+void
+EvolverBase::setStatisticsCallback(const StatisticsCallback & callback)
+{
+    _statisticsCallback = callback;
+    if (_statisticsCallback)
+    {
+        if (! _populationStatistics)
+        {
+            _populationStatistics = new PopulationStatistics;
+        }
+    }
+    else
+    {
+        delete _populationStatistics;
+        _populationStatistics = nullptr;
+    }
+} // EvolverBase::setStatisticsCallback
+
+void
+EvolverBase::setWorkerCount(const size_t numWorkers)
+{
+    delete _workers;
+    _workers = nullptr;
+    if (1 != numWorkers)
+    {
+        _workers = new WorkerPool(numWorkers);
+        if (1 == _workers->getThreadCount())
+        {
+            // Only one hardware thread, so there is nothing to share.
+            delete _workers;
+            _workers = nullptr;
+        }
+    }
+} // EvolverBase::setWorkerCount
+
+void
+EvolverBase::startSamples(void)
+{
+    if (_allocationAccountingEnabled)
+    {
+        _allocationSample.generation = _generation;
+        _allocationSample.phases.fill(AllocationCounts());
+        ResetAllocationPeak();
+        ReadAllocationCounts(_phaseStartAllocations);
+    }
+    if (_counters)
+    {
+        _counterSample.generation = _generation;
+        for (size_t ii = 0; kNumEnginePhases > ii; ++ii)
+        {
+            _counterSample.phases[ii].fill(0);
+        }
+        _counters->read(_phaseStartCounters);
+    }
+} // EvolverBase::startSamples
+
+void
+EvolverBase::step(void)
+{
+    PhaseStatistics::Clock::time_point generationStartTime = startPhase();
+    PhaseStatistics::Clock::time_point startTime = generationStartTime;
+    
+    startSamples();
+    // Published coefficients are only picked up between generations, so that every object in a
+    // generation is scored with the same coefficients.
+    applyPublishedProfile();
+    calculateFitnessValues();
+    startTime = finishPhase(kPhaseFitness, startTime);
+    if (_populationStatistics)
+    {
+        _populationStatistics->reset();
+        collectStatistics(*_populationStatistics);
+        _populationStatistics->finish(_generation, _generationStatistics);
+        startTime = finishPhase(kPhaseStatistics, startTime);
+    }
+    makeSelection();
+    startTime = finishPhase(kPhaseSelection, startTime);
+    doCrossovers();
+    startTime = finishPhase(kPhaseCrossover, startTime);
+    doMutations();
+    _fitnessValuesCurrent = false;
+    finishPhase(kPhaseMutation, startTime);
+    finishPhase(kPhaseGeneration, generationStartTime);
+    finishSamples(false);
+    if (_instrumentationEnabled)
+    {
+        _phaseStatistics.addIndividuals(populationSize.getValue());
+    }
+    if (_populationStatistics)
+    {
+        // The function is called outside of the phases, so that its time is not counted.
+        _statisticsCallback(_generationStatistics);
+    }
+    ++_generation;
+} // EvolverBase::step
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,539 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleEvolverBase.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for the common part of the Evolver objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_EvolverBase_H_))
+# define Scuddle_EvolverBase_H_ /* Header guard */
+
+# include "ScuddleAllocationCounters.h"
+# include "ScuddleCommon.h"
+# include "ScuddleFitnessCache.h"
+# include "ScuddleFitnessProfile.h"
+# include "ScuddlePerformanceCounters.h"
+# include "ScuddlePhaseStatistics.h"
+# include "ScuddlePopulationStatistics.h"
+# include "ScuddleProfilePublisher.h"
+# include "ScuddleTrace.h"
+# include "ScuddleWorkerPool.h"
+
+# include <cstdint>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the common part of the Evolver objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief The parameters, random number generator and generation loop that are shared by all
+     the Scuddle evolution engines.
+     
+     Each engine owns its population, its parameters and its random number generator, so that
+     several independent evolutions can be run side by side. */
+    class EvolverBase
+    {
+    public :
+        
+        /*! @brief The destructor. */
+        virtual
+        ~EvolverBase(void);
+        
+        /*! @brief Bring the fitness values up to date and make the final selections.
+         @param selectionSize The number of objects to be selected. */
+        void
+        finalSelection(const size_t selectionSize);
+        
+        /*! @brief Return the memory allocations made during each phase of each generation,
+         recorded while allocation accounting was enabled.
+         @returns The memory allocations made during each phase of each generation. */
+        const AllocationSampleVector &
+        getAllocationSamples(void)
+        const
+        {
+            return _allocationSamples;
+        } // getAllocationSamples
+        
+        /*! @brief Return the changes in the hardware performance counters over each phase of each
+         generation, recorded while the counters were enabled.
+         @returns The changes in the hardware performance counters. */
+        const CounterSampleVector &
+        getCounterSamples(void)
+        const
+        {
+            return _counterSamples;
+        } // getCounterSamples
+        
+        /*! @brief Return the number of generations that have been produced since the population
+         was created.
+         @returns The number of generations that have been produced. */
+        size_t
+        getGeneration(void)
+        const
+        {
+            return _generation;
+        } // getGeneration
+        
+        /*! @brief Return the hardware performance counters.
+         @returns The hardware performance counters, or @c nullptr if they are not enabled. */
+        const PerformanceCounters *
+        getPerformanceCounters(void)
+        const
+        {
+            return _counters;
+        } // getPerformanceCounters
+        
+        /*! @brief Return the durations of the phases recorded while instrumentation was enabled,
+         along with the amount of work done.
+         @returns The durations of the phases and the amount of work done. */
+        const PhaseStatistics &
+        getPhaseStatistics(void)
+        const
+        {
+            return _phaseStatistics;
+        } // getPhaseStatistics
+        
+        /*! @brief Return the fraction of fitness evaluations that were skipped because the
+         objects had not changed since their previous evaluation.
+         @returns The fraction of fitness evaluations that were skipped since the population was
+         created. */
+        double
+        getSkippedEvaluationRatio(void)
+        const;
+        
+        /*! @brief Return the identifier of the engine in trace events.
+         @returns The identifier of the engine in trace events. */
+        uint32_t
+        getTraceSourceId(void)
+        const
+        {
+            return _traceSourceId;
+        } // getTraceSourceId
+        
+        /*! @brief Return the number of threads used to calculate fitness values.
+         @returns The number of threads used to calculate fitness values. */
+        size_t
+        getWorkerCount(void)
+        const;
+        
+        /*! @brief Discard any existing objects and create a new population. */
+        virtual void
+        init(void) = 0;
+        
+        /*! @brief Return @c true if the phases of the engine are being timed.
+         @returns @c true if the phases of the engine are being timed. */
+        bool
+        isInstrumentationEnabled(void)
+        const
+        {
+            return _instrumentationEnabled;
+        } // isInstrumentationEnabled
+        
+        /*! @brief Bring the fitness values up to date with the fitness coefficients.
+         
+         If the population has not changed since its fitness values were last calculated, the
+         stored fitness factors of each object are combined with the current coefficients, so
+         that changing a coefficient does not require the objects to be classified again. */
+        void
+        rescore(void);
+        
+        /*! @brief Discard the recorded durations of the phases and amounts of work. */
+        void
+        resetPhaseStatistics(void)
+        {
+            _phaseStatistics.reset();
+        } // resetPhaseStatistics
+        
+        /*! @brief Start or stop counting the memory allocations made during each phase.
+         
+         The counts cover the whole process, so allocations made by other threads while a phase
+         is running are included, as are those of other engines that are stepped at the same
+         time. Enabling accounting discards any earlier samples; disabling it keeps them, so that
+         they can still be reported.
+         @param enabled @c true if the allocations are to be counted. */
+        void
+        setAllocationAccountingEnabled(const bool enabled);
+        
+        /*! @brief Set the cache used to look up fitness factors.
+         
+         The cache is not owned by the engine, so that it can be shared between engines and can
+         outlive them. Engines that evaluate their whole population at once do not use the cache.
+         @param cache The cache to use, or @c nullptr to always calculate the fitness values. */
+        void
+        setFitnessCache(FitnessCache * cache)
+        {
+            _fitnessCache = cache;
+        } // setFitnessCache
+        
+        /*! @brief Start or stop timing the phases of the engine.
+         
+         While disabled, the clock is not read and nothing is recorded.
+         @param enabled @c true if the phases are to be timed. */
+        void
+        setInstrumentationEnabled(const bool enabled)
+        {
+            _instrumentationEnabled = enabled;
+        } // setInstrumentationEnabled
+        
+        /*! @brief Start or stop reading the hardware performance counters around each phase.
+         
+         The counters follow the calling thread and the threads that it creates afterwards, so
+         they should be enabled before setWorkerCount is called. Enabling the counters discards
+         any earlier samples.
+         @param enabled @c true if the counters are to be read.
+         @returns @c true if the counters are disabled or at least one counter is available. */
+        bool
+        setPerformanceCountersEnabled(const bool enabled);
+        
+        /*! @brief Set the source of published fitness coefficients.
+         
+         The most recently published coefficients replace those of fitnessProfile at the start of
+         each generation and before the final selections. The publisher is not owned by the
+         engine, so that it can be shared between engines.
+         @param publisher The source of published coefficients, or @c nullptr if fitnessProfile
+         is only changed directly. */
+        void
+        setProfilePublisher(ProfilePublisher * publisher)
+        {
+            _profilePublisher = publisher;
+            _profileVersion = 0;
+        } // setProfilePublisher
+        
+        /*! @brief Set the function that is given a summary of the population each generation.
+         
+         The summary is made after the fitness values are calculated, in a separate phase, and the
+         function is called at the end of the generation, on the calling thread.
+         @param callback The function to be called, or an empty function if the population is not
+         to be summarized. */
+        void
+        setStatisticsCallback(const StatisticsCallback & callback);
+        
+        /*! @brief Set the number of threads used to calculate fitness values.
+         
+         The threads persist until the number is changed or the engine is destroyed.
+         @param numWorkers The number of threads to use, including the calling thread; @c 0 uses
+         one thread per hardware thread and @c 1 calculates fitness values on the calling thread
+         only. */
+        void
+        setWorkerCount(const size_t numWorkers);
+        
+        /*! @brief Produce the next generation from the current population. */
+        void
+        step(void);
+        
+    protected :
+        
+        /*! @brief The constructor.
+         
+         The random number generator is seeded from the system entropy source. */
+        EvolverBase(void);
+        
+        /*! @brief The constructor.
+         @param seed The seed for the random number generator. */
+        explicit
+        EvolverBase(const uint64_t seed);
+        
+        /*! @brief Update the fitness value for the objects. */
+        virtual void
+        calculateFitnessValues(void) = 0;
+        
+        /*! @brief Add each of the objects to a summary of the population.
+         @param statistics The summary to be added to. */
+        virtual void
+        collectStatistics(PopulationStatistics & statistics) = 0;
+        
+        /*! @brief Generate a new set of objects, using the selected parents. */
+        virtual void
+        doCrossovers(void) = 0;
+        
+        /*! @brief Mutate some of the objects. */
+        virtual void
+        doMutations(void) = 0;
+        
+        /*! @brief Process a range of objects, sharing the work among the fitness threads.
+         
+         All the work is done before this returns, so the task can refer to local variables; it
+         should capture no more than two pointers or references, so that it is held without a
+         heap allocation.
+         @param numObjects The number of objects to be processed.
+         @param task The work to be done on each chunk of the range. */
+        void
+        forEachRange(const size_t                  numObjects,
+                     const WorkerPool::RangeTask & task);
+        
+        /*! @brief Return the cache used to look up fitness values.
+         @returns The cache used to look up fitness values, or @c nullptr if there is none. */
+        FitnessCache *
+        getFitnessCache(void)
+        const
+        {
+            return _fitnessCache;
+        } // getFitnessCache
+        
+        /*! @brief Return the random number generator for this engine.
+         @returns The random number generator for this engine. */
+        RandomGenerator &
+        getGenerator(void)
+        {
+            return _generator;
+        } // getGenerator
+        
+        /*! @brief Return the number of objects to select as parents.
+         @param numObjects The number of objects in the population.
+         @returns The number of objects to select as parents. */
+        size_t
+        getParentCount(const size_t numObjects)
+        const;
+        
+        /*! @brief Make the final selections.
+         @param selectionSize The number of objects to be selected. */
+        virtual void
+        makeFinalSelection(const size_t selectionSize) = 0;
+        
+        /*! @brief Make the selections for this iteration. */
+        virtual void
+        makeSelection(void) = 0;
+        
+        /*! @brief Return a uniformly distributed random number in the range lowValue..highValue.
+         @param lowValue The lower bound for the output.
+         @param highValue The upper bound for the output.
+         @returns A uniformly distributed random number in the range lowValue..highValue. */
+        realType
+        randRealInRange(const realType lowValue,
+                        const realType highValue);
+        
+        /*! @brief Return a uniformly distributed random number in the range 0..highValue.
+         @param highValue The upper bound for the output.
+         @returns A uniformly distributed random number in the range 0..highValue. */
+        size_t
+        randUnsignedInRange(const size_t highValue);
+        
+        /*! @brief Record the outcome of a round of fitness evaluations.
+         @param numObjects The number of objects whose fitness values were updated.
+         @param numSkipped The number of objects that did not need to be evaluated again. */
+        void
+        recordEvaluations(const size_t numObjects,
+                          const size_t numSkipped)
+        {
+            _numEvaluations += numObjects;
+            _numSkippedEvaluations += numSkipped;
+            if (_instrumentationEnabled)
+            {
+                _phaseStatistics.addEvaluations(numObjects - numSkipped);
+            }
+        } // recordEvaluations
+        
+        /*! @brief Apply the current fitness coefficients to the fitness factors of the objects. */
+        virtual void
+        rescoreFitnessValues(void) = 0;
+        
+        /*! @brief Restart the generation count and the evaluation counts. */
+        void
+        resetGeneration(void)
+        {
+            _generation = 0;
+            _numEvaluations = 0;
+            _numSkippedEvaluations = 0;
+            _fitnessValuesCurrent = false;
+        } // resetGeneration
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        EvolverBase(const EvolverBase & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        EvolverBase &
+        operator =(const EvolverBase & other);
+        
+        /*! @brief Replace the fitness coefficients with the most recently published ones, if
+         they have changed. */
+        void
+        applyPublishedProfile(void)
+        {
+            if (_profilePublisher)
+            {
+                _profilePublisher->update(fitnessProfile, _profileVersion);
+            }
+        } // applyPublishedProfile
+        
+        /*! @brief Record the changes in the hardware performance counters and the memory
+         allocations over a generation or the final selections, if they are enabled.
+         @param finalSelection @c true if the samples cover the final selections. */
+        void
+        finishSamples(const bool finalSelection);
+        
+        /*! @brief Finish timing a phase and start timing the next one.
+         
+         The duration is recorded if instrumentation is enabled, a trace event is recorded if
+         tracing is enabled and the changes in the hardware performance counters and the memory
+         allocations are recorded if they are enabled.
+         @param phase The phase that has finished.
+         @param startTime The time at which the phase started.
+         @returns The time at which the next phase starts, if the phases are being timed. */
+        PhaseStatistics::Clock::time_point
+        finishPhase(const EnginePhase                          phase,
+                    const PhaseStatistics::Clock::time_point & startTime);
+        
+        /*! @brief Start recording the changes in the hardware performance counters and the memory
+         allocations, if they are enabled. */
+        void
+        startSamples(void);
+        
+        /*! @brief Start timing a phase.
+         @returns The time at which the phase starts, if the phases are being timed. */
+        PhaseStatistics::Clock::time_point
+        startPhase(void)
+        const
+        {
+            return ((_instrumentationEnabled || IsTracingEnabled()) ?
+                    PhaseStatistics::Clock::now() : PhaseStatistics::Clock::time_point());
+        } // startPhase
+        
+    public :
+        
+        /*! @brief The number of attributes to swap, for engines that use CrossoverByCount. */
+        ConstrainedUnsignedValue crossoverCount;
+        
+        /*! @brief The fraction of attributes to swap, for engines that use CrossoverByFraction. */
+        ConstrainedRealValue crossoverFraction;
+        
+        /*! @brief The fitness coefficients used by this engine.
+         
+         The coefficients are read once for each round of fitness evaluations. */
+        FitnessProfile fitnessProfile;
+        
+        /*! @brief The fraction of the set of objects that are to be mutated. */
+        ConstrainedRealValue mutationFraction;
+        
+        /*! @brief The number of objects to generate. */
+        ConstrainedUnsignedValue populationSize;
+        
+        /*! @brief The fraction of the set of objects that are selected. */
+        ConstrainedRealValue selectionFraction;
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The durations of the phases and the amount of work done. */
+        PhaseStatistics _phaseStatistics;
+        
+        /*! @brief The function that is given the summary of the population each generation. */
+        StatisticsCallback _statisticsCallback;
+        
+        /*! @brief The summary of the population for the current generation. */
+        GenerationStatistics _generationStatistics;
+        
+        /*! @brief The memory allocations made during each recorded generation. */
+        AllocationSampleVector _allocationSamples;
+        
+        /*! @brief The memory allocations made during the current generation. */
+        AllocationSample _allocationSample;
+        
+        /*! @brief The memory allocation counts when the current phase started. */
+        AllocationCounts _phaseStartAllocations;
+        
+        /*! @brief The changes in the hardware performance counters over each recorded
+         generation. */
+        CounterSampleVector _counterSamples;
+        
+        /*! @brief The changes in the hardware performance counters over the current generation. */
+        CounterSample _counterSample;
+        
+        /*! @brief The readings of the hardware performance counters when the current phase
+         started. */
+        CounterReadings _phaseStartCounters;
+        
+        /*! @brief The random number generator for this engine. */
+        RandomGenerator _generator;
+        
+        /*! @brief The threads used to calculate fitness values, or @c nullptr if the fitness
+         values are calculated on the calling thread only. */
+        WorkerPool * _workers;
+        
+        /*! @brief The cache used to look up fitness values, or @c nullptr if there is none. */
+        FitnessCache * _fitnessCache;
+        
+        /*! @brief The hardware performance counters, or @c nullptr if they are not enabled. */
+        PerformanceCounters * _counters;
+        
+        /*! @brief The gatherer of the summary of the population, or @c nullptr if the population
+         is not summarized. */
+        PopulationStatistics * _populationStatistics;
+        
+        /*! @brief The source of published fitness coefficients, or @c nullptr if there is none. */
+        ProfilePublisher * _profilePublisher;
+        
+        /*! @brief The number of generations since the population was created. */
+        size_t _generation;
+        
+        /*! @brief The number of fitness values updated since the population was created. */
+        uint64_t _numEvaluations;
+        
+        /*! @brief The number of fitness values updated without evaluating the object again. */
+        uint64_t _numSkippedEvaluations;
+        
+        /*! @brief The identifier of the engine in trace events. */
+        uint32_t _traceSourceId;
+        
+        /*! @brief The version of the published fitness coefficients that was last applied. */
+        uint32_t _profileVersion;
+        
+        /*! @brief @c true if the memory allocations made during each phase are being counted. */
+        bool _allocationAccountingEnabled;
+        
+        /*! @brief @c true if the fitness factors of the objects match their attributes. */
+        bool _fitnessValuesCurrent;
+        
+        /*! @brief @c true if the phases of the engine are being timed. */
+        bool _instrumentationEnabled;
+        
+    }; // EvolverBase
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_EvolverBase_H_) */
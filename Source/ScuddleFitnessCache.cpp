@@ -0,0 +1,365 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleFitnessCache.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for the fitness memoization cache.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+
+#include "ScuddleFitnessCache.h"
+
+#include <atomic>
+
+#if (defined(__APPLE__) || defined(__linux__))
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif // defined(__APPLE__) || defined(__linux__)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the fitness memoization cache. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief An entry of the table.
+ 
+ The sequence number is odd while the entry is being written; a reader that sees the same even
+ sequence number before and after reading the key and the factors has a consistent pair. */
+struct FitnessCache::Slot
+{
+    /*! @brief The key for the factors, or @c 0 if the entry is empty. */
+    std::atomic<uint64_t> _key;
+    
+    /*! @brief The sequence number of the entry. */
+    std::atomic<uint32_t> _sequence;
+    
+    /*! @brief The fitness factors, packed into a single word. */
+    std::atomic<uint32_t> _factors;
+    
+}; // FitnessCache::Slot
+
+/*! @brief The start of a file that holds a table. */
+struct FileHeader
+{
+    /*! @brief Identifies the file as holding a table. */
+    uint64_t _magic;
+    
+    /*! @brief The version of the layout of the file. */
+    uint32_t _version;
+    
+    /*! @brief The size of each entry. */
+    uint32_t _slotSize;
+    
+    /*! @brief The number of entries. */
+    uint64_t _capacity;
+    
+    /*! @brief Unused, so that the entries are aligned. */
+    uint64_t _reserved;
+    
+}; // FileHeader
+
+/*! @brief The value that identifies a file as holding a table ('SCDFCACH'). */
+static const uint64_t kFileMagic = 0x5343444643414348;
+
+/*! @brief The version of the layout of the file. */
+static const uint32_t kFileVersion = 2;
+
+/*! @brief The number of entries that a key can occupy. */
+static const size_t kSlotsPerBucket = 4;
+
+// The fitness factors are held in a single atomic word, so that they can be read without tearing.
+static_assert(sizeof(FitnessFactors) == sizeof(uint32_t),
+              "FitnessFactors objects must fit in 32 bits");
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the capacity to use for a table.
+ @param capacity The requested number of entries.
+ @returns The smallest power of two that is at least the requested number of entries and at
+ least one bucket. */
+static size_t
+roundCapacity(const size_t capacity)
+{
+    size_t result = kSlotsPerBucket;
+    
+    while (capacity > result)
+    {
+        result <<= 1;
+    }
+    return result;
+} // roundCapacity
+
+/*! @brief Return the key as stored in an entry.
+ @param key The key for an entry.
+ @returns The key, adjusted so that it cannot be mistaken for an empty entry. */
+static inline uint64_t
+storedKey(const uint64_t key)
+{
+    return (key ? key : 1);
+} // storedKey
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+FitnessCache::FitnessCache(const size_t capacity) :
+    _slots(nullptr), _mapping(nullptr), _mappingSize(0), _capacity(roundCapacity(capacity))
+{
+    _slots = new Slot[_capacity];
+    clear();
+} // FitnessCache::FitnessCache
+
+FitnessCache::FitnessCache(const size_t        capacity,
+                           const std::string & filePath) :
+    _slots(nullptr), _mapping(nullptr), _mappingSize(0), _capacity(roundCapacity(capacity))
+{
+    if (! mapFile(filePath))
+    {
+        _slots = new Slot[_capacity];
+        clear();
+    }
+} // FitnessCache::FitnessCache
+
+FitnessCache::~FitnessCache(void)
+{
+    if (_mapping)
+    {
+#if (defined(__APPLE__) || defined(__linux__))
+        munmap(_mapping, _mappingSize);
+#endif // defined(__APPLE__) || defined(__linux__)
+    }
+    else
+    {
+        delete[] _slots;
+    }
+} // FitnessCache::~FitnessCache
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+FitnessCache::clear(void)
+{
+    for (size_t ii = 0; _capacity > ii; ++ii)
+    {
+        Slot & aSlot = _slots[ii];
+        
+        aSlot._key.store(0, std::memory_order_relaxed);
+        aSlot._sequence.store(0, std::memory_order_relaxed);
+        aSlot._factors.store(0, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+} // FitnessCache::clear
+
+bool
+FitnessCache::find(const uint64_t   key,
+                   FitnessFactors & factors)
+const
+{
+    uint64_t     wanted = storedKey(key);
+    const Slot * bucket = (_slots + (wanted & (_capacity - kSlotsPerBucket)));
+    bool         found = false;
+    
+    for (size_t ii = 0; (! found) && (kSlotsPerBucket > ii); ++ii)
+    {
+        const Slot & aSlot = bucket[ii];
+        uint32_t     before = aSlot._sequence.load(std::memory_order_acquire);
+        
+        if (0 == (before & 1))
+        {
+            uint64_t aKey = aSlot._key.load(std::memory_order_relaxed);
+            uint32_t packed = aSlot._factors.load(std::memory_order_relaxed);
+            
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if ((wanted == aKey) && (before == aSlot._sequence.load(std::memory_order_relaxed)))
+            {
+                memcpy(&factors, &packed, sizeof(factors));
+                found = true;
+            }
+        }
+    }
+    return found;
+} // FitnessCache::find
+
+void
+FitnessCache::insert(const uint64_t         key,
+                     const FitnessFactors & factors)
+{
+    uint64_t wanted = storedKey(key);
+    Slot *   bucket = (_slots + (wanted & (_capacity - kSlotsPerBucket)));
+    Slot *   target = nullptr;
+    uint32_t packed;
+    
+    memcpy(&packed, &factors, sizeof(packed));
+    for (size_t ii = 0; kSlotsPerBucket > ii; ++ii)
+    {
+        uint64_t aKey = bucket[ii]._key.load(std::memory_order_relaxed);
+        
+        if (wanted == aKey)
+        {
+            // Already present; the factors for a key never change.
+            return;
+        }
+        
+        if ((0 == aKey) && (nullptr == target))
+        {
+            target = (bucket + ii);
+        }
+    }
+    if (nullptr == target)
+    {
+        // The bucket is full, so replace an entry chosen by the key bits that did not pick the
+        // bucket.
+        target = (bucket + ((wanted >> 32) % kSlotsPerBucket));
+    }
+    uint32_t sequence = target->_sequence.load(std::memory_order_relaxed);
+    
+    // If another thread is writing to the entry, drop the factors rather than wait.
+    if ((0 == (sequence & 1)) &&
+        target->_sequence.compare_exchange_strong(sequence, sequence + 1,
+                                                  std::memory_order_acquire,
+                                                  std::memory_order_relaxed))
+    {
+        std::atomic_thread_fence(std::memory_order_release);
+        target->_key.store(wanted, std::memory_order_relaxed);
+        target->_factors.store(packed, std::memory_order_relaxed);
+        target->_sequence.store(sequence + 2, std::memory_order_release);
+    }
+} // FitnessCache::insert
+
+bool
+FitnessCache::mapFile(const std::string & filePath)
+{
+    bool okSoFar = false;
+    
+#if (defined(__APPLE__) || defined(__linux__))
+    size_t fileSize = (sizeof(FileHeader) + (_capacity * sizeof(Slot)));
+    
+    // Other processes can only share the entries if the atomic operations do not use locks.
+    if (std::atomic<uint64_t>().is_lock_free() && std::atomic<uint32_t>().is_lock_free())
+    {
+        int fd = open(filePath.c_str(), O_RDWR | O_CREAT, 0644);
+        
+        if (0 <= fd)
+        {
+            struct stat fileStatus;
+            bool        resized = ((0 != fstat(fd, &fileStatus)) ||
+                                   (fileSize != static_cast<size_t>(fileStatus.st_size)));
+            
+            if ((! resized) || (0 == ftruncate(fd, static_cast<off_t>(fileSize))))
+            {
+                void * mapping = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                                      0);
+                
+                if (MAP_FAILED != mapping)
+                {
+                    FileHeader * header = static_cast<FileHeader *>(mapping);
+                    
+                    _mapping = mapping;
+                    _mappingSize = fileSize;
+                    _slots = reinterpret_cast<Slot *>(static_cast<char *>(mapping) +
+                                                      sizeof(FileHeader));
+                    if (resized || (kFileMagic != header->_magic) ||
+                        (kFileVersion != header->_version) ||
+                        (sizeof(Slot) != header->_slotSize) || (_capacity != header->_capacity))
+                    {
+                        // The identification is only written once the entries are valid.
+                        header->_magic = 0;
+                        clear();
+                        header->_version = kFileVersion;
+                        header->_slotSize = sizeof(Slot);
+                        header->_capacity = _capacity;
+                        header->_reserved = 0;
+                        header->_magic = kFileMagic;
+                    }
+                    else
+                    {
+                        // Discard any entries that were being written when a previous run
+                        // stopped.
+                        for (size_t ii = 0; _capacity > ii; ++ii)
+                        {
+                            Slot &   aSlot = _slots[ii];
+                            uint32_t sequence = aSlot._sequence.load(std::memory_order_relaxed);
+                            
+                            if (sequence & 1)
+                            {
+                                aSlot._key.store(0, std::memory_order_relaxed);
+                                aSlot._sequence.store(sequence + 1, std::memory_order_relaxed);
+                            }
+                        }
+                    }
+                    okSoFar = true;
+                }
+            }
+            close(fd);
+        }
+    }
+#else // ! (defined(__APPLE__) || defined(__linux__))
+    static_cast<void>(filePath);
+#endif // ! (defined(__APPLE__) || defined(__linux__))
+    return okSoFar;
+} // FitnessCache::mapFile
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
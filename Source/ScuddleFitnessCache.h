@@ -0,0 +1,228 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleFitnessCache.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for the fitness memoization cache.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+
+#if (! defined(Scuddle_FitnessCache_H_))
+# define Scuddle_FitnessCache_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+# include "ScuddleFitnessTables.h"
+
+# include <cstdint>
+# include <cstring>
+# include <string>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the fitness memoization cache. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief A fixed-capacity table of fitness factors, keyed by a hash of the attributes of an
+     object.
+     
+     The factors do not depend on the fitness coefficients, so the entries remain valid when the
+     coefficients are changed.
+     
+     Any number of threads can look up and add values at the same time, without locks; each
+     entry is guarded by its own sequence number, and a thread that finds an entry being written
+     treats it as missing rather than waiting. The entries are grouped into buckets of four, and
+     when a bucket is full a new value replaces one of its entries.
+     
+     The table can be held in a file that is mapped into memory, so that the values survive from
+     one run to the next. */
+    class FitnessCache
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The table is held in memory only.
+         @param capacity The number of entries; this is rounded up to a power of two. */
+        explicit
+        FitnessCache(const size_t capacity);
+        
+        /*! @brief The constructor.
+         
+         The table is held in the given file, which is created if it does not exist. If the file
+         holds a table of a different capacity or layout, the table is cleared. If the file
+         cannot be mapped, the table is held in memory only.
+         @param capacity The number of entries; this is rounded up to a power of two.
+         @param filePath The path to the file that holds the table. */
+        FitnessCache(const size_t        capacity,
+                     const std::string & filePath);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~FitnessCache(void);
+        
+        /*! @brief Remove all the entries.
+         
+         This must not be called while other threads are using the table. */
+        void
+        clear(void);
+        
+        /*! @brief Look up the fitness factors of an object.
+         @param key The key for the factors.
+         @param factors Set to the fitness factors, if they were found.
+         @returns @c true if the factors were found and @c false otherwise. */
+        bool
+        find(const uint64_t   key,
+             FitnessFactors & factors)
+        const;
+        
+        /*! @brief Return the number of entries.
+         @returns The number of entries. */
+        size_t
+        getCapacity(void)
+        const
+        {
+            return _capacity;
+        } // getCapacity
+        
+        /*! @brief Add the fitness factors of an object.
+         
+         The factors are dropped if another thread is writing to the same entry.
+         @param key The key for the factors.
+         @param factors The fitness factors. */
+        void
+        insert(const uint64_t         key,
+               const FitnessFactors & factors);
+        
+        /*! @brief Return @c true if the table is held in a file.
+         @returns @c true if the table is held in a file and @c false if it is held in memory
+         only. */
+        bool
+        isMapped(void)
+        const
+        {
+            return (nullptr != _mapping);
+        } // isMapped
+        
+    protected :
+        
+    private :
+        
+        /*! @brief An entry of the table. */
+        struct Slot;
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        FitnessCache(const FitnessCache & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        FitnessCache &
+        operator =(const FitnessCache & other);
+        
+        /*! @brief Map the table from a file.
+         @param filePath The path to the file that holds the table.
+         @returns @c true if the file was mapped and @c false otherwise. */
+        bool
+        mapFile(const std::string & filePath);
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The entries. */
+        Slot * _slots;
+        
+        /*! @brief The start of the mapped file, or @c nullptr if the table is held in memory
+         only. */
+        void * _mapping;
+        
+        /*! @brief The size of the mapped file. */
+        size_t _mappingSize;
+        
+        /*! @brief The number of entries. */
+        size_t _capacity;
+        
+    }; // FitnessCache
+    
+    /*! @brief Combine a value with a hash.
+     
+     The combination uses the splitmix64 finalizer, so that every bit of the value affects every
+     bit of the result.
+     @param hash The hash to be extended.
+     @param value The value to be combined.
+     @returns The combined hash. */
+    inline uint64_t
+    HashCombine(const uint64_t hash,
+                const uint64_t value)
+    {
+        uint64_t result = ((hash ^ value) + 0x9E3779B97F4A7C15);
+        
+        result = ((result ^ (result >> 30)) * 0xBF58476D1CE4E5B9);
+        result = ((result ^ (result >> 27)) * 0x94D049BB133111EB);
+        return (result ^ (result >> 31));
+    } // HashCombine
+    
+    /*! @brief Combine a floating-point value with a hash.
+     
+     Both zeroes give the same result, as they give the same fitness values.
+     @param hash The hash to be extended.
+     @param value The value to be combined.
+     @returns The combined hash. */
+    inline uint64_t
+    HashCombineReal(const uint64_t hash,
+                    const realType value)
+    {
+        uint64_t bits = 0;
+        
+        if (0 != value)
+        {
+            memcpy(&bits, &value, sizeof(value));
+        }
+        return HashCombine(hash, bits);
+    } // HashCombineReal
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_FitnessCache_H_) */
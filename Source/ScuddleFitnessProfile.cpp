@@ -0,0 +1,299 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleFitnessProfile.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for the sets of fitness coefficients.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleFitnessProfile.h"
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the sets of fitness coefficients. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+
+/*! @brief The initial fitness coefficient for Bartenieff contralateral configurations. */
+static const realType kInitialBartenieffContralateral = static_cast<realType>(1.3);
+
+/*! @brief The initial fitness coefficient for Bartenieff distal configurations. */
+static const realType kInitialBartenieffDistal = static_cast<realType>(0.4);
+
+/*! @brief The initial fitness coefficient for Bartenieff homolateral configurations. */
+static const realType kInitialBartenieffHomolateral = static_cast<realType>(0.5);
+
+/*! @brief The initial fitness coefficient for Bartenieff homologous configurations. */
+static const realType kInitialBartenieffHomologous = static_cast<realType>(0.4);
+
+/*! @brief The initial fitness coefficient for Bartenieff medial configurations. */
+static const realType kInitialBartenieffMedial = static_cast<realType>(0.7);
+
+/*! @brief The initial fitness coefficient for high Effort configurations. */
+static const realType kInitialEffortHigh = static_cast<realType>(1.4);
+
+/*! @brief The initial fitness coefficient for low Effort configurations. */
+static const realType kInitialEffortLow = static_cast<realType>(0.6);
+
+/*! @brief The initial fitness coefficient for medium Effort configurations. */
+static const realType kInitialEffortMedium = static_cast<realType>(1.2);
+
+/*! @brief The initial fitness coefficient for fully extended leg configurations. */
+static const realType kInitialFullyExtendedLeg = static_cast<realType>(1.1);
+
+/*! @brief The initial fitness coefficient for lower leg extended configurations. */
+static const realType kInitialLowerLegExtended = static_cast<realType>(1.3);
+
+/*! @brief The initial fitness coefficient for unextended leg configurations. */
+static const realType kInitialUnextendedLegs = static_cast<realType>(0.3);
+
+/*! @brief The maximum fitness coefficient for Bartenieff contralateral configurations. */
+static const realType kMaximumBartenieffContralateral = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for Bartenieff distal configurations. */
+static const realType kMaximumBartenieffDistal = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for Bartenieff homolateral configurations. */
+static const realType kMaximumBartenieffHomolateral = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for Bartenieff homologous configurations. */
+static const realType kMaximumBartenieffHomologous = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for Bartenieff medial configurations. */
+static const realType kMaximumBartenieffMedial = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for high Effort configurations. */
+static const realType kMaximumEffortHigh = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for low Effort configurations. */
+static const realType kMaximumEffortLow = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for medium Effort configurations. */
+static const realType kMaximumEffortMedium = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for fully extended leg configurations. */
+static const realType kMaximumFullyExtendedLeg = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for lower leg extended configurations. */
+static const realType kMaximumLowerLegExtended = static_cast<realType>(10);
+
+/*! @brief The maximum fitness coefficient for unextended leg configurations. */
+static const realType kMaximumUnextendedLegs = static_cast<realType>(10);
+
+/*! @brief The minimum fitness coefficient for Bartenieff contralateral configurations. */
+static const realType kMinimumBartenieffContralateral = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for Bartenieff distal configurations. */
+static const realType kMinimumBartenieffDistal = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for Bartenieff homolateral configurations. */
+static const realType kMinimumBartenieffHomolateral = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for Bartenieff homologous configurations. */
+static const realType kMinimumBartenieffHomologous = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for Bartenieff medial configurations. */
+static const realType kMinimumBartenieffMedial = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for high Effort configurations. */
+static const realType kMinimumEffortHigh = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for low Effort configurations. */
+static const realType kMinimumEffortLow = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for medium Effort configurations. */
+static const realType kMinimumEffortMedium = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for fully extended leg configurations. */
+static const realType kMinimumFullyExtendedLeg = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for lower leg extended configurations. */
+static const realType kMinimumLowerLegExtended = static_cast<realType>(0);
+
+/*! @brief The minimum fitness coefficient for unextended leg configurations. */
+static const realType kMinimumUnextendedLegs = static_cast<realType>(0);
+
+/*! @brief A coefficient and its name. */
+struct NamedCoefficient
+{
+    /*! @brief The name of the coefficient. */
+    const char * _name;
+    
+    /*! @brief The coefficient. */
+    ConstrainedRealValue FitnessProfile::* _member;
+    
+}; // NamedCoefficient
+
+/*! @brief The coefficients that can be set by name. */
+static const NamedCoefficient kNamedCoefficients[] =
+{
+    { "bartenieffContralateral", &FitnessProfile::bartenieffContralateral },
+    { "bartenieffDistal", &FitnessProfile::bartenieffDistal },
+    { "bartenieffHomolateral", &FitnessProfile::bartenieffHomolateral },
+    { "bartenieffHomologous", &FitnessProfile::bartenieffHomologous },
+    { "bartenieffMedial", &FitnessProfile::bartenieffMedial },
+    { "effortHigh", &FitnessProfile::effortHigh },
+    { "effortLow", &FitnessProfile::effortLow },
+    { "effortMedium", &FitnessProfile::effortMedium },
+    { "fullyExtendedLeg", &FitnessProfile::fullyExtendedLeg },
+    { "lowerLegExtended", &FitnessProfile::lowerLegExtended },
+    { "unextendedLegs", &FitnessProfile::unextendedLegs }
+};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+FitnessProfile::FitnessProfile(void) :
+    bartenieffContralateral(kMinimumBartenieffContralateral, kMaximumBartenieffContralateral,
+                            kInitialBartenieffContralateral),
+    bartenieffDistal(kMinimumBartenieffDistal, kMaximumBartenieffDistal, kInitialBartenieffDistal),
+    bartenieffHomolateral(kMinimumBartenieffHomolateral, kMaximumBartenieffHomolateral,
+                          kInitialBartenieffHomolateral),
+    bartenieffHomologous(kMinimumBartenieffHomologous, kMaximumBartenieffHomologous,
+                         kInitialBartenieffHomologous),
+    bartenieffMedial(kMinimumBartenieffMedial, kMaximumBartenieffMedial, kInitialBartenieffMedial),
+    effortHigh(kMinimumEffortHigh, kMaximumEffortHigh, kInitialEffortHigh),
+    effortLow(kMinimumEffortLow, kMaximumEffortLow, kInitialEffortLow),
+    effortMedium(kMinimumEffortMedium, kMaximumEffortMedium, kInitialEffortMedium),
+    fullyExtendedLeg(kMinimumFullyExtendedLeg, kMaximumFullyExtendedLeg, kInitialFullyExtendedLeg),
+    lowerLegExtended(kMinimumLowerLegExtended, kMaximumLowerLegExtended, kInitialLowerLegExtended),
+    unextendedLegs(kMinimumUnextendedLegs, kMaximumUnextendedLegs, kInitialUnextendedLegs)
+{
+} // FitnessProfile::FitnessProfile
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+FitnessProfile::getCoefficients(FitnessCoefficients & coefficients)
+const
+{
+    coefficients.bartenieff[kBartenieffClassNone] = 0;
+    coefficients.bartenieff[kBartenieffClassDistal] = bartenieffDistal.getValue();
+    coefficients.bartenieff[kBartenieffClassMedial] = bartenieffMedial.getValue();
+    coefficients.bartenieff[kBartenieffClassHomologous] = bartenieffHomologous.getValue();
+    coefficients.bartenieff[kBartenieffClassHomolateral] = bartenieffHomolateral.getValue();
+    coefficients.bartenieff[kBartenieffClassContralateral] = bartenieffContralateral.getValue();
+    coefficients.effort[kEffortClassLow] = effortLow.getValue();
+    coefficients.effort[kEffortClassMedium] = effortMedium.getValue();
+    coefficients.effort[kEffortClassHigh] = effortHigh.getValue();
+    coefficients.height[kHeightClassNone] = 0;
+    coefficients.height[kHeightClassUnextendedLegs] = unextendedLegs.getValue();
+    coefficients.height[kHeightClassLowerLegExtended] = lowerLegExtended.getValue();
+    coefficients.height[kHeightClassFullyExtendedLeg] = fullyExtendedLeg.getValue();
+} // FitnessProfile::getCoefficients
+
+void
+FitnessProfile::resetValues(void)
+{
+    bartenieffContralateral.resetValue();
+    bartenieffDistal.resetValue();
+    bartenieffHomolateral.resetValue();
+    bartenieffHomologous.resetValue();
+    bartenieffMedial.resetValue();
+    effortHigh.resetValue();
+    effortLow.resetValue();
+    effortMedium.resetValue();
+    fullyExtendedLeg.resetValue();
+    lowerLegExtended.resetValue();
+    unextendedLegs.resetValue();
+} // FitnessProfile::resetValues
+
+void
+FitnessProfile::setCoefficients(const FitnessCoefficients & coefficients)
+{
+    bartenieffDistal.setValue(coefficients.bartenieff[kBartenieffClassDistal]);
+    bartenieffMedial.setValue(coefficients.bartenieff[kBartenieffClassMedial]);
+    bartenieffHomologous.setValue(coefficients.bartenieff[kBartenieffClassHomologous]);
+    bartenieffHomolateral.setValue(coefficients.bartenieff[kBartenieffClassHomolateral]);
+    bartenieffContralateral.setValue(coefficients.bartenieff[kBartenieffClassContralateral]);
+    effortLow.setValue(coefficients.effort[kEffortClassLow]);
+    effortMedium.setValue(coefficients.effort[kEffortClassMedium]);
+    effortHigh.setValue(coefficients.effort[kEffortClassHigh]);
+    unextendedLegs.setValue(coefficients.height[kHeightClassUnextendedLegs]);
+    lowerLegExtended.setValue(coefficients.height[kHeightClassLowerLegExtended]);
+    fullyExtendedLeg.setValue(coefficients.height[kHeightClassFullyExtendedLeg]);
+} // FitnessProfile::setCoefficients
+
+bool
+FitnessProfile::setValue(const std::string & name,
+                         const realType      newValue)
+{
+    size_t numCoefficients = (sizeof(kNamedCoefficients) / sizeof(*kNamedCoefficients));
+    bool   found = false;
+    
+    for (size_t ii = 0; (! found) && (numCoefficients > ii); ++ii)
+    {
+        if (name == kNamedCoefficients[ii]._name)
+        {
+            (this->*kNamedCoefficients[ii]._member).setValue(newValue);
+            found = true;
+        }
+    }
+    return found;
+} // FitnessProfile::setValue
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,164 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleFitnessProfile.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for the sets of fitness coefficients.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_FitnessProfile_H_))
+# define Scuddle_FitnessProfile_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+# include "ScuddleFitnessTables.h"
+
+# include <string>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the sets of fitness coefficients. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief A set of fitness coefficients.
+     
+     Each evolution engine has its own set, so that engines with different weightings can run
+     side by side. The coefficients that a kind of object does not use are ignored. */
+    class FitnessProfile
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The coefficients are set to their initial values. */
+        FitnessProfile(void);
+        
+        /*! @brief The copy constructor.
+         @param other The object to be copied. */
+        FitnessProfile(const FitnessProfile & other) = default;
+        
+        /*! @brief The destructor. */
+        ~FitnessProfile(void) = default;
+        
+        /*! @brief Return the current values of the coefficients, indexed by the classes that
+         select them.
+         @param coefficients Set to the current values of the coefficients. */
+        void
+        getCoefficients(FitnessCoefficients & coefficients)
+        const;
+        
+        /*! @brief The assignment operator.
+         @param other The object to be copied.
+         @returns The updated object. */
+        FitnessProfile &
+        operator =(const FitnessProfile & other) = default;
+        
+        /*! @brief Reset the coefficients to their initial values. */
+        void
+        resetValues(void);
+        
+        /*! @brief Set the coefficients from values indexed by the classes that select them.
+         
+         Each value is limited to the range of its coefficient.
+         @param coefficients The new values of the coefficients. */
+        void
+        setCoefficients(const FitnessCoefficients & coefficients);
+        
+        /*! @brief Set a coefficient, given its name.
+         
+         The names are those of the members, such as 'effortHigh'. The value is limited to the
+         range of the coefficient.
+         @param name The name of the coefficient.
+         @param newValue The value to be used.
+         @returns @c true if the name is that of a coefficient and @c false otherwise. */
+        bool
+        setValue(const std::string & name,
+                 const realType      newValue);
+        
+    protected :
+        
+    private :
+        
+    public :
+        
+        /*! @brief The fitness coefficient for Bartenieff contralateral configurations. */
+        ConstrainedRealValue bartenieffContralateral;
+        
+        /*! @brief The fitness coefficient for Bartenieff distal configurations. */
+        ConstrainedRealValue bartenieffDistal;
+        
+        /*! @brief The fitness coefficient for Bartenieff homolateral configurations. */
+        ConstrainedRealValue bartenieffHomolateral;
+        
+        /*! @brief The fitness coefficient for Bartenieff homologous configurations. */
+        ConstrainedRealValue bartenieffHomologous;
+        
+        /*! @brief The fitness coefficient for Bartenieff medial configurations. */
+        ConstrainedRealValue bartenieffMedial;
+        
+        /*! @brief The fitness coefficient for high Effort configurations. */
+        ConstrainedRealValue effortHigh;
+        
+        /*! @brief The fitness coefficient for low Effort configurations. */
+        ConstrainedRealValue effortLow;
+        
+        /*! @brief The fitness coefficient for medium Effort configurations. */
+        ConstrainedRealValue effortMedium;
+        
+        /*! @brief The fitness coefficient for fully extended leg configurations. */
+        ConstrainedRealValue fullyExtendedLeg;
+        
+        /*! @brief The fitness coefficient for lower leg extended configurations. */
+        ConstrainedRealValue lowerLegExtended;
+        
+        /*! @brief The fitness coefficient for unextended leg configurations. */
+        ConstrainedRealValue unextendedLegs;
+        
+    protected :
+        
+    private :
+        
+    }; // FitnessProfile
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_FitnessProfile_H_) */
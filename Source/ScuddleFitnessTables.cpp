@@ -0,0 +1,226 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleFitnessTables.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The definitions for the precomputed fitness classification tables.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleFitnessTables.h"
+
+#include "ScuddleSkeleton.h"
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The definitions for the precomputed fitness classification tables. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The bits of a quadrant signature that hold a single angle. */
+static const size_t kQuadrantSignatureMask = 0x03;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the Bartenieff class for a quadrant signature.
+ @param signature The quadrant signature to be classified.
+ @returns The Bartenieff class for the signature. */
+static BartenieffClass
+classifyQuadrants(const size_t signature)
+{
+    BartenieffClass result = kBartenieffClassNone;
+    int             quadrants[Skeleton::kNumCalculatedAngles];
+    int             quadrantScore = 0;
+    bool            valid = true;
+    
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        size_t code = ((signature >> (kQuadrantSignatureBitsPerAngle * ii)) &
+                       kQuadrantSignatureMask);
+        
+        // Only the quadrants 1, 2 and 4 can occur.
+        if (kQuadrantSignatureMask == code)
+        {
+            valid = false;
+        }
+        quadrants[ii] = (1 << code);
+        quadrantScore += quadrants[ii];
+    }
+    if (valid)
+    {
+        bool pairedQuadrants =
+                ((quadrants[Skeleton::kLeftShoulderToElbow] ==
+                  quadrants[Skeleton::kLeftElbowToWrist]) &&
+                 (quadrants[Skeleton::kRightShoulderToElbow] ==
+                  quadrants[Skeleton::kRightElbowToWrist]) &&
+                 (quadrants[Skeleton::kLeftHipToKnee] == quadrants[Skeleton::kLeftKneeToFoot]) &&
+                 (quadrants[Skeleton::kRightHipToKnee] == quadrants[Skeleton::kRightKneeToFoot]));
+        
+        if ((8 == quadrantScore) && pairedQuadrants)
+        {
+            result = kBartenieffClassDistal;
+        }
+        else if ((12 == quadrantScore) && pairedQuadrants)
+        {
+            result = kBartenieffClassMedial;
+        }
+        else if (((quadrants[Skeleton::kLeftShoulderToElbow] ==
+                   quadrants[Skeleton::kRightShoulderToElbow]) &&
+                  (quadrants[Skeleton::kLeftElbowToWrist] ==
+                   quadrants[Skeleton::kRightElbowToWrist])) ||
+                 ((quadrants[Skeleton::kLeftHipToKnee] ==
+                   quadrants[Skeleton::kRightHipToKnee]) &&
+                  (quadrants[Skeleton::kLeftKneeToFoot] ==
+                   quadrants[Skeleton::kRightKneeToFoot])))
+        {
+            result = kBartenieffClassHomologous;
+        }
+    }
+    return result;
+} // classifyQuadrants
+
+/*! @brief Return the Effort class for a set of packed Effort qualities.
+ @param effort The packed Effort qualities.
+ @returns The Effort class for the qualities. */
+static EffortClass
+classifyEffort(const size_t effort)
+{
+    EffortClass   result;
+    WeightQuality weight = ((effort & EffortCode(kWeightStrong, kSpaceIndirect, kTimeSustained,
+                                                 kFlowFree)) ? kWeightStrong : kWeightLight);
+    SpaceQuality  space = ((effort & EffortCode(kWeightLight, kSpaceDirect, kTimeSustained,
+                                                kFlowFree)) ? kSpaceDirect : kSpaceIndirect);
+    TimeQuality   time = ((effort & EffortCode(kWeightLight, kSpaceIndirect, kTimeSudden,
+                                               kFlowFree)) ? kTimeSudden : kTimeSustained);
+    FlowQuality   flow = ((effort & EffortCode(kWeightLight, kSpaceIndirect, kTimeSustained,
+                                               kFlowBound)) ? kFlowBound : kFlowFree);
+    
+    if (((kWeightLight == weight) && (kSpaceIndirect == space) && (kTimeSustained == time) &&
+         (kFlowFree == flow)) || ((kWeightStrong == weight) && (kSpaceDirect == space) &&
+                                  (kTimeSudden == time) && (kFlowBound == flow)))
+    {
+        result = kEffortClassLow;
+    }
+    else if ((ReallyClose(MapWeightToReal(weight), MapSpaceToReal(space)) &&
+              ReallyClose(MapTimeToReal(time), MapFlowToReal(flow))) ||
+             (ReallyClose(MapWeightToReal(weight), MapTimeToReal(time)) &&
+              ReallyClose(MapSpaceToReal(space), MapFlowToReal(flow))) ||
+             (ReallyClose(MapWeightToReal(weight), MapFlowToReal(flow)) &&
+              ReallyClose(MapSpaceToReal(space), MapTimeToReal(time))))
+    {
+        result = kEffortClassMedium;
+    }
+    else
+    {
+        result = kEffortClassHigh;
+    }
+    return result;
+} // classifyEffort
+
+/*! @brief Return a newly built set of fitness classification tables.
+ @returns A newly built set of fitness classification tables. */
+static FitnessTables
+makeFitnessTables(void)
+{
+    FitnessTables result;
+    
+    for (size_t ii = 0; kNumQuadrantSignatures > ii; ++ii)
+    {
+        result.bartenieffClasses[ii] = static_cast<uint8_t>(classifyQuadrants(ii));
+    }
+    for (size_t ii = 0; kNumEffortCodes > ii; ++ii)
+    {
+        result.effortClasses[ii] = static_cast<uint8_t>(classifyEffort(ii));
+    }
+    for (size_t ii = 0; kNumHeightCodes > ii; ++ii)
+    {
+        HeightValue height = static_cast<HeightValue>(ii);
+        
+        if ((kHeightLow == height) || (kHeightMiddle == height) || (kHeightHigh == height))
+        {
+            result.heightScores[ii] = 1;
+        }
+        else
+        {
+            result.heightScores[ii] = 3;
+        }
+        result.bentLegs[ii] = ((kHeightMidLow == height) || (kHeightMiddle == height) ||
+                               (kHeightMidHigh == height));
+    }
+    return result;
+} // makeFitnessTables
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+const FitnessTables &
+Scuddle::GetFitnessTables(void)
+{
+    static const FitnessTables tables(makeFitnessTables());
+    
+    return tables;
+} // Scuddle::GetFitnessTables
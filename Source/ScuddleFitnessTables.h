@@ -0,0 +1,259 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleFitnessTables.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The declarations for the precomputed fitness classification tables.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_FitnessTables_H_))
+# define Scuddle_FitnessTables_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+
+# include <array>
+# include <cstdint>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The declarations for the precomputed fitness classification tables. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief The Bartenieff configurations; the first four are determined by the quadrants
+     alone. */
+    enum BartenieffClass
+    {
+        /*! @brief The quadrants do not determine a configuration. */
+        kBartenieffClassNone,
+        
+        /*! @brief A distal configuration. */
+        kBartenieffClassDistal,
+        
+        /*! @brief A medial configuration. */
+        kBartenieffClassMedial,
+        
+        /*! @brief A homologous configuration, unless the angles give a homolateral or
+         contralateral one. */
+        kBartenieffClassHomologous,
+        
+        /*! @brief A homolateral configuration; this is determined by the angles, and so never
+         appears in the tables. */
+        kBartenieffClassHomolateral,
+        
+        /*! @brief A contralateral configuration; this is determined by the angles, and so never
+         appears in the tables. */
+        kBartenieffClassContralateral
+        
+    }; // BartenieffClass
+    
+    /*! @brief The number of Bartenieff configurations. */
+    const size_t kNumBartenieffClasses = (kBartenieffClassContralateral + 1);
+    
+    /*! @brief The level of Effort for a set of Effort qualities. */
+    enum EffortClass
+    {
+        /*! @brief All four qualities match. */
+        kEffortClassLow,
+        
+        /*! @brief The qualities match in pairs. */
+        kEffortClassMedium,
+        
+        /*! @brief The qualities do not match. */
+        kEffortClassHigh
+        
+    }; // EffortClass
+    
+    /*! @brief The number of levels of Effort. */
+    const size_t kNumEffortClasses = (kEffortClassHigh + 1);
+    
+    /*! @brief The leg configurations that contribute to the fitness value at a Height level
+     where the legs might be bent. */
+    enum HeightClass
+    {
+        /*! @brief The legs are not bent, so that there is no contribution. */
+        kHeightClassNone,
+        
+        /*! @brief No leg is extended. */
+        kHeightClassUnextendedLegs,
+        
+        /*! @brief Only a lower leg is extended. */
+        kHeightClassLowerLegExtended,
+        
+        /*! @brief One leg is fully extended. */
+        kHeightClassFullyExtendedLeg
+        
+    }; // HeightClass
+    
+    /*! @brief The number of leg configurations. */
+    const size_t kNumHeightClasses = (kHeightClassFullyExtendedLeg + 1);
+    
+    /*! @brief The number of bits of a quadrant signature that are used for each angle. */
+    const size_t kQuadrantSignatureBitsPerAngle = 2;
+    
+    /*! @brief The number of distinct quadrant signatures. */
+    const size_t kNumQuadrantSignatures = (static_cast<size_t>(1) <<
+                                           (kQuadrantSignatureBitsPerAngle * 8));
+    
+    /*! @brief The number of distinct sets of packed Effort qualities. */
+    const size_t kNumEffortCodes = 16;
+    
+    /*! @brief The number of table entries for the Height levels. */
+    const size_t kNumHeightCodes = 8;
+    
+    /*! @brief The fitness rules that only depend on discrete attributes, precomputed for every
+     combination of those attributes.
+     
+     The Bartenieff classes are indexed by the quadrant signature of a set of angles, the Effort
+     classes by the packed Effort qualities and the Height entries by the Height level. Only the
+     homolateral and contralateral configurations, which compare the angles themselves, are left
+     to be determined when the fitness is calculated. */
+    struct FitnessTables
+    {
+        /*! @brief The BartenieffClass for each quadrant signature. */
+        std::array<uint8_t, kNumQuadrantSignatures> bartenieffClasses;
+        
+        /*! @brief The EffortClass for each set of packed Effort qualities. */
+        std::array<uint8_t, kNumEffortCodes> effortClasses;
+        
+        /*! @brief The quadrant score contribution for each Height level. */
+        std::array<uint8_t, kNumHeightCodes> heightScores;
+        
+        /*! @brief @c true for the Height levels where the legs might not be extended. */
+        std::array<bool, kNumHeightCodes> bentLegs;
+        
+    }; // FitnessTables
+    
+    /*! @brief The values of the fitness coefficients, indexed by the classes that select them.
+     
+     The entries for kBartenieffClassNone and kHeightClassNone are always zero, and any class
+     that a kind of object does not use also has a zero entry. */
+    struct FitnessCoefficients
+    {
+        /*! @brief The coefficient for each BartenieffClass. */
+        std::array<realType, kNumBartenieffClasses> bartenieff;
+        
+        /*! @brief The coefficient for each EffortClass. */
+        std::array<realType, kNumEffortClasses> effort;
+        
+        /*! @brief The coefficient for each HeightClass. */
+        std::array<realType, kNumHeightClasses> height;
+        
+    }; // FitnessCoefficients
+    
+    /*! @brief Everything about an object that its fitness value depends on, apart from the
+     fitness coefficients.
+     
+     The factors of an object only change when its attributes change, so that a new set of
+     coefficients can be applied without classifying the object again. */
+    struct FitnessFactors
+    {
+        /*! @brief The BartenieffClass of the object. */
+        uint8_t bartenieffClass;
+        
+        /*! @brief The EffortClass of the object. */
+        uint8_t effortClass;
+        
+        /*! @brief The HeightClass of the object. */
+        uint8_t heightClass;
+        
+        /*! @brief The sum of the quadrants, including the contribution of the Height level. */
+        uint8_t quadrantScore;
+        
+    }; // FitnessFactors
+    
+    /*! @brief Return the packed form of a set of Effort qualities.
+     
+     The qualities are packed in the same way as for PoseBatch::PackEffort.
+     @param weight The Weight Quality value.
+     @param space The Space Quality value.
+     @param time The Time Quality value.
+     @param flow The Flow Quality value.
+     @returns The packed Effort qualities. */
+    inline size_t
+    EffortCode(const WeightQuality weight,
+               const SpaceQuality  space,
+               const TimeQuality   time,
+               const FlowQuality   flow)
+    {
+        return ((kWeightStrong == weight ? 0x01 : 0) | (kSpaceDirect == space ? 0x02 : 0) |
+                (kTimeSudden == time ? 0x04 : 0) | (kFlowBound == flow ? 0x08 : 0));
+    } // EffortCode
+    
+    /*! @brief Return the fitness classification tables.
+     
+     The tables are built the first time that they are requested, and can then be shared by all
+     threads.
+     @returns The fitness classification tables. */
+    const FitnessTables &
+    GetFitnessTables(void);
+    
+    /*! @brief Return the contribution of one angle to a quadrant signature.
+     
+     The signature of a set of angles is the combination of the contributions of all the angles.
+     @param angleIndex The index of the angle, from Skeleton::AngleIndices.
+     @param quadrant The quadrant of the angle; one of 1, 2 or 4.
+     @returns The contribution of the angle to the quadrant signature. */
+    inline size_t
+    QuadrantSignatureBits(const size_t angleIndex,
+                          const int    quadrant)
+    {
+        return ((static_cast<size_t>(quadrant) >> 1) << (kQuadrantSignatureBitsPerAngle *
+                                                         angleIndex));
+    } // QuadrantSignatureBits
+    
+    /*! @brief Return the fitness value for a set of factors.
+     @param coefficients The fitness coefficients to be applied.
+     @param factors The factors of the object.
+     @returns The fitness value for the factors. */
+    inline realType
+    ScoreFitnessFactors(const FitnessCoefficients & coefficients,
+                        const FitnessFactors &      factors)
+    {
+        return ((coefficients.bartenieff[factors.bartenieffClass] +
+                 coefficients.effort[factors.effortClass] +
+                 coefficients.height[factors.heightClass]) * factors.quadrantScore);
+    } // ScoreFitnessFactors
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_FitnessTables_H_) */
@@ -35,16 +35,14 @@
 //  Created:    2015-06-16
 //
 //--------------------------------------------------------------------------------------------------
+#include "ScuddleBatchEvolver.h"
+#include "ScuddleEvolver.h"
+#include "ScuddleProfileWatcher.h"
+#include "ScuddleTrace.h"
 
-#include "ScuddleBody.h"
-#include "ScuddleSkeleton.h"
-
+#include <fstream>
 #include <iostream>
-#if MAC_OR_LINUX_
-# include <sys/time.h>
-#else // ! MAC_OR_LINUX_
-# include <sys/timeb.h>
-#endif // ! MAC_OR_LINUX_
+#include <string>
 
 #if defined(__APPLE__)
 # pragma clang diagnostic push
@@ -69,66 +67,34 @@ using namespace Scuddle;
 
 #define PRINT_VALUES_ /* Print out values of interest. */
 
-//#define REPORT_TIMES_ /* Print out the time to do various operations. */
-
-#if defined(USE_SKELETON_)
-/*! @brief A sequence of Skeleton objects. */
-typedef std::vector<Skeleton *> SkeletonVector;
-#else // ! defined(USE_SKELETON_)
-/*! @brief A sequence of Body objects. */
-typedef std::vector<Body *> BodyVector;
-#endif // ! defined(USE_SKELETON_)
+/*! @brief The kinds of engine that can be run. */
+enum EngineKind
+{
+    /*! @brief Skeleton objects, stored column-wise. */
+    kEngineBatch,
+    
+    /*! @brief Skeleton objects with binary angles. */
+    kEngineBinarySkeleton,
+    
+    /*! @brief Skeleton objects with binary angles, packed into as few bytes as possible. */
+    kEnginePackedSkeleton,
+    
+    /*! @brief Body objects. */
+    kEngineBody,
+    
+    /*! @brief Body objects that also generate joint positions. */
+    kEnginePositionedBody,
+    
+    /*! @brief Skeleton objects. */
+    kEngineSkeleton
+    
+}; // EngineKind
 
-#if defined(USE_SKELETON_)
 /*! @brief A sequence of indices of Skeleton objects. */
 typedef std::vector<int> IndexVector;
-#endif // defined(USE_SKELETON_)
-
-#if (defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_)))
-/*! @brief The initial position of the left side of the hips for new Body objects. */
-static const Coordinate2D kLeftHip(120, 220);
-#endif // defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_))
-
-#if (defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_)))
-/*! @brief The initial position of the left shoulder for new Body objects. */
-static const Coordinate2D kLeftShoulder(110, 100);
-#endif // defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_))
-
-#if (defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_)))
-/*! @brief The initial position of the neck for new Body objects. */
-static const Coordinate2D kNeck(155, 110);
-#endif // defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_))
-
-#if (defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_)))
-/*! @brief The initial position of the right side of the hips for new Body objects. */
-static const Coordinate2D kRightHip(190, 220);
-#endif // defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_))
-
-#if (defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_)))
-/*! @brief The initial position of the right shoulder for new Body objects. */
-static const Coordinate2D kRightShoulder(200, 100);
-#endif // defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_))
-
-#if (defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_)))
-/*! @brief The initial position of the 'tail' for new Body objects. */
-static const Coordinate2D kTail(155, 210);
-#endif // defined(GENERATE_POSITIONS_) && (! defined(USE_SKELETON_))
-
-#if defined(USE_FRACTION_FOR_CROSSOVER_)
-/*! @brief The fraction of attributes to swap. */
-static const realType kCrossoverFraction = static_cast<realType>(0.50);
-#endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-
-/*! @brief The fraction of the set of Body or Skeleton objects that are to be mutated. */
-static const realType kMutationFraction = static_cast<realType>(0.10);
-
-/*! @brief The fraction of the set of Body or Skeleton objects that are selected. */
-static const realType kSelectionFraction = static_cast<realType>(0.20);
-
-#if (! defined(USE_FRACTION_FOR_CROSSOVER_))
-/*! @brief The number of attributes to swap. */
-static const size_t kCrossoverCount = 2;
-#endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
+
+/*! @brief The number of entries in the fitness cache, when one is used. */
+static const size_t kFitnessCacheCapacity = (static_cast<size_t>(1) << 20);
 
 /*! @brief The number of selections to present when finished. */
 static const size_t kFinalSelectionSize = 5;
@@ -136,38 +102,15 @@ static const size_t kFinalSelectionSize = 5;
 /*! @brief The number of iterations to perform. */
 static const size_t kIterationCount = 5;
 
-#if defined(USE_SKELETON_)
+/*! @brief The number of threads to use for calculating fitness values; @c 0 uses one thread per
+ hardware thread. */
+static const size_t kWorkerCount = 0;
+
 /*! @brief The number of angles in each Skeleton. */
 static const size_t kNumDisplayedAngles = 31;
-#endif // defined(USE_SKELETON_)
 
-#if defined(USE_SKELETON_)
 /*! @brief The number of quaternions to print per row. */
 static const size_t kNumQuaternionsPerRow = 3;
-#endif // defined(USE_SKELETON_)
-
-/*! @brief The number of Body or Skeleton objects to generate. */
-static const size_t kPopulationSize = 200; // MUST BE EVEN!!!
-
-#if defined(USE_SKELETON_)
-/*! @brief The set of Skeleton objects that are worked on. */
-static SkeletonVector * lPopulation = nullptr;
-#else // ! defined(USE_SKELETON_)
-/*! @brief The set of Body objects that are worked on. */
-static BodyVector * lPopulation = nullptr;
-#endif // ! defined(USE_SKELETON_)
-
-#if defined(USE_SKELETON_)
-/*! @brief The set of Skeleton objects that have been selected. */
-static SkeletonVector * lSelection = nullptr;
-#else // ! defined(USE_SKELETON_)
-/*! @brief The set of Body objects that have been selected. */
-static BodyVector * lSelection = nullptr;
-#endif // ! defined(USE_SKELETON_)
-
-#if defined(USE_SKELETON_)
-static IndexVector * lIndices = nullptr;
-#endif // ! defined(USE_SKELETON_)
 
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
@@ -177,106 +120,10 @@ static IndexVector * lIndices = nullptr;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
-#if defined(REPORT_TIMES_)
-/*! @brief Return the number of milliseconds since an arbitrary time in the past.
- @returns The number of milliseconds since an arbitrary time in the past. */
-static double
-getMillisecondsSinceEpoch(void)
-{
-    double result;
-# if MAC_OR_LINUX_
-    struct timeval tv;
-# else // ! MAC_OR_LINUX_
-    struct _timeb  tt;
-# endif // ! MAC_OR_LINUX_
-    
-# if MAC_OR_LINUX_
-    gettimeofday(&tv, nullptr);
-    result = (tv.tv_sec * 1000.0) + (tv.tv_usec / 1000.0);
-# else // ! MAC_OR_LINUX_
-    _ftime_s(&tt);
-    result = (tt.time * 1000.0) + tt.millitm;
-# endif // ! MAC_OR_LINUX_
-    return result;
-} // getMillisecondsSinceEpoch
-#endif // defined(REPORT_TIMES_)
-
-/*! @brief Update the fitness value for the Body or Skeleton objects. */
-static void
-calculateFitnessValues(void)
-{
-#if defined(PRINT_VALUES_)
-    std::cout << "Calculating fitness." << std::endl;
-#endif // defined(PRINT_VALUES_)
-#if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
-    {
-        Skeleton * aSkeleton = *walker;
-        
-        if (aSkeleton)
-        {
-            aSkeleton->updateFitness();
-        }
-    }
-#else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker; ++walker)
-    {
-        Body * aBody = *walker;
-        
-        if (aBody)
-        {
-            aBody->updateFitness();
-        }
-    }
-#endif // ! defined(USE_SKELETON_)
-} // calculateFitnessValues
-
-/*! @brief Release the objects that were created earlier. */
-static void
-cleanup(void)
-{
-#if defined(PRINT_VALUES_)
-    std::cout << "Cleaning up." << std::endl;
-#endif // defined(PRINT_VALUES_)
-#if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
-    {
-        Skeleton * aSkeleton = *walker;
-        
-        if (aSkeleton)
-        {
-            delete aSkeleton;
-        }
-    }
-#else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker; ++walker)
-    {
-        Body * aBody = *walker;
-        
-        if (aBody)
-        {
-            delete aBody;
-        }
-    }
-#endif // ! defined(USE_SKELETON_)
-    lPopulation->clear();
-    lSelection->clear();
-    delete lPopulation;
-    lPopulation = nullptr;
-    delete lSelection;
-    lSelection = nullptr;
-#if defined(USE_SKELETON_)
-    delete lIndices;
-    lIndices = nullptr;
-#endif // defined(USE_SKELETON_)
-} // cleanup
-
-#if defined(USE_SKELETON_)
-/*! @brief Generate the mapping information for the quaternion outputs. */
+/*! @brief Generate the mapping information for the quaternion outputs.
+ @param indices The mapping from displayed angles to Skeleton angles. */
 static void
-createMapForAngles(void)
+createMapForAngles(IndexVector & indices)
 {
     // DANGER!! DANGER!!
     // Changing the CMU skeleton structure will break this!
@@ -323,25 +170,26 @@ createMapForAngles(void)
                 break;
                 
         }
-        lIndices->push_back(dispIndex);
+        indices.push_back(dispIndex);
     }
 } // createMapForAngles
-#endif // defined(USE_SKELETON_)
 
-#if defined(USE_SKELETON_)
-/*! @brief Print the parameters of a Skeleton object.
- @param aSkeleton The Skeleton object to be printed. */
+/*! @brief Print the angles of a pose as quaternions.
+ @param getQuaternion A function that returns a specific angle of the pose as a quaternion.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+template <typename QuaternionSource>
 static void
-printSkeleton(Skeleton & aSkeleton)
+printQuaternions(QuaternionSource    getQuaternion,
+                 const IndexVector & indices)
 {
-    for (size_t ii = 0, imax = lIndices->size(), jj = 0; imax > ii; ++ii, ++jj)
+    for (size_t ii = 0, imax = indices.size(), jj = 0; imax > ii; ++ii, ++jj)
     {
-        int       dispIndex = (*lIndices)[ii];
+        int       dispIndex = indices[ii];
         glm::quat aQuat;
         
         if (0 <= dispIndex)
         {
-            aQuat = aSkeleton.getAngleAsQuaternion(static_cast<size_t>(dispIndex));
+            aQuat = getQuaternion(static_cast<size_t>(dispIndex));
         }
         else
         {
@@ -367,12 +215,41 @@ printSkeleton(Skeleton & aSkeleton)
         std::cout << "[" << aQuat.x << "," << aQuat.y << "," << aQuat.z << "," << aQuat.w << "]";
     }
     std::cout << std::endl;
+} // printQuaternions
+
+/*! @brief Print the parameters of a pose from a PoseBatch object.
+ @param poses The PoseBatch object containing the pose to be printed.
+ @param poseIndex The index of the pose to be printed.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+static void
+printSkeleton(const PoseBatch &   poses,
+              const size_t        poseIndex,
+              const IndexVector & indices)
+{
+    printQuaternions([&poses, poseIndex] (const size_t angleIndex)
+                     {
+                         return poses.getAngleAsQuaternion(poseIndex, angleIndex);
+                     }, indices);
 } // printSkeleton
-#else // ! defined(USE_SKELETON_)
+
+/*! @brief Print the parameters of a Skeleton or BinarySkeleton object.
+ @param aSkeleton The object to be printed.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+template <typename SkeletonType>
+static void
+printSkeleton(const SkeletonType & aSkeleton,
+              const IndexVector &  indices)
+{
+    printQuaternions([&aSkeleton] (const size_t angleIndex)
+                     {
+                         return aSkeleton.getAngleAsQuaternion(angleIndex);
+                     }, indices);
+} // printSkeleton
+
 /*! @brief Print the parameters of a Body object.
  @param aBody The Body object to be printed. */
 static void
-printBody(Body & aBody)
+printBody(const Body & aBody)
 {
     std::cout << RadiansToDegrees(aBody.getLeftShoulderToElbowAngle()) << "," <<
                 RadiansToDegrees(aBody.getLeftElbowToWristAngle()) << "," <<
@@ -386,413 +263,284 @@ printBody(Body & aBody)
                 "," << MapTimeToReal(aBody.getTime()) << "," << MapFlowToReal(aBody.getFlow()) <<
                 std::endl;
 } // printBody
-#endif // ! defined(USE_SKELETON_)
 
-#if defined(USE_SKELETON_)
-/*! @brief Create a set of Skeleton objects to work with.
- @param numSkeletons The number of Skeleton objects to create. */
+/*! @brief Print a newly created Body object.
+ @param aBody The Body object to be printed. */
 static void
-generateSkeletons(const size_t numSkeletons)
+printNewObject(const Body & aBody)
 {
-# if defined(PRINT_VALUES_)
-    std::cout << "Generating " << numSkeletons << " objects." << std::endl;
-# endif // defined(PRINT_VALUES_)
-    for (size_t ii = 0; numSkeletons > ii; ++ii)
-    {
-        Skeleton * aSkeleton = new Skeleton;
-        
-        lPopulation->push_back(aSkeleton);
-# if defined(PRINT_VALUES_)
-        if (0 < lIndices->size())
-        {
-            if (0 < ii)
-            {
-                std::cout << std::endl;
-            }
-            printSkeleton(*aSkeleton);
-        }
-# endif // defined(PRINT_VALUES_)
-    }
-} // generateSkeletons
-#else // ! defined(USE_SKELETON_)
-/*! @brief Create a set of Body objects to work with.
- @param numBodies The number of Body objects to create. */
+    printBody(aBody);
+} // printNewObject
+
+/*! @brief Newly created BinarySkeleton objects are not printed. */
 static void
-generateBodies(const size_t numBodies)
+printNewObject(const BinarySkeleton & )
 {
-# if defined(PRINT_VALUES_)
-    std::cout << "Generating " << numBodies << " objects." << std::endl;
-# endif // defined(PRINT_VALUES_)
-    for (size_t ii = 0; numBodies > ii; ++ii)
-    {
-# if defined(GENERATE_POSITIONS_)
-        Body * aBody = new Body(kLeftHip, kLeftShoulder, kNeck, kRightHip, kRightShoulder, kTail);
-# else // ! defined(GENERATE_POSITIONS_)
-        Body * aBody = new Body;
-# endif // ! defined(GENERATE_POSITIONS_)
-        
-        lPopulation->push_back(aBody);
-# if defined(PRINT_VALUES_)
-        printBody(*aBody);
-# endif // defined(PRINT_VALUES_)
-    }
-} // generateBodies
-#endif // ! defined(USE_SKELETON_)
+} // printNewObject
 
-/*! @brief Make the selections for this iteration. */
+/*! @brief Newly created PackedSkeleton objects are not printed. */
 static void
-makeSelection(void)
+printNewObject(const PackedSkeleton & )
 {
-#if defined(PRINT_VALUES_)
-    std::cout << "Making selection." << std::endl;
-#endif // defined(PRINT_VALUES_)
-    realType sumOfScore = 0;
+} // printNewObject
+
+/*! @brief Newly created Skeleton objects are not printed. */
+static void
+printNewObject(const Skeleton & )
+{
+} // printNewObject
+
+/*! @brief Print a BinarySkeleton object from the final selection.
+ @param aSkeleton The BinarySkeleton object to be printed.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+static void
+printSelectedObject(const BinarySkeleton & aSkeleton,
+                    const IndexVector &    indices)
+{
+    std::cout << "Final Selection:" << std::endl;
+    printSkeleton(aSkeleton, indices);
+} // printSelectedObject
+
+/*! @brief Print a PackedSkeleton object from the final selection.
+ @param aSkeleton The PackedSkeleton object to be printed.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+static void
+printSelectedObject(const PackedSkeleton & aSkeleton,
+                    const IndexVector &    indices)
+{
+    std::cout << "Final Selection:" << std::endl;
+    printSkeleton(aSkeleton, indices);
+} // printSelectedObject
+
+/*! @brief Print a Body object from the final selection.
+ @param aBody The Body object to be printed. */
+static void
+printSelectedObject(const Body &        aBody,
+                    const IndexVector & )
+{
+    std::cout << "Final Selection: ";
+    printBody(aBody);
+} // printSelectedObject
+
+/*! @brief Print a Skeleton object from the final selection.
+ @param aSkeleton The Skeleton object to be printed.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+static void
+printSelectedObject(const Skeleton &    aSkeleton,
+                    const IndexVector & indices)
+{
+    std::cout << "Final Selection:" << std::endl;
+    printSkeleton(aSkeleton, indices);
+} // printSelectedObject
+
+/*! @brief Print the objects of a newly created population.
+ @param anEvolver The engine holding the population. */
+template <typename Genome,
+          typename CrossoverPolicy>
+static void
+printInitialPopulation(const Evolver<Genome, CrossoverPolicy> & anEvolver)
+{
+    typedef typename Evolver<Genome, CrossoverPolicy>::Population Population;
     
-#if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
-    {
-        Skeleton * aSkeleton = *walker;
-        
-        if (aSkeleton)
-        {
-            sumOfScore += aSkeleton->getFitnessScore();
-        }
-    }
-#else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker; ++walker)
-    {
-        Body * aBody = *walker;
-        
-        if (aBody)
-        {
-            sumOfScore += aBody->getFitnessScore();
-        }
-    }
-#endif // ! defined(USE_SKELETON_)
-    lSelection->clear();
-    for (size_t ii = 0, imax = static_cast<size_t>(lPopulation->size() * kSelectionFraction);
-         imax > ii; )
+    const Population & population = anEvolver.getPopulation();
+    
+    for (typename Population::const_iterator walker(population.begin());
+         population.end() != walker; ++walker)
     {
-        realType sumOfArrayIndices = 0;
-        realType chooseArray = RandRealInRange(0, sumOfScore);
-        
-#if defined(USE_SKELETON_)
-        for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-             ++walker)
-        {
-            Skeleton * aSkeleton = *walker;
-            
-            if (aSkeleton && (! aSkeleton->isMarked()))
-            {
-                realType score = aSkeleton->getFitnessScore();
-                
-                if ((chooseArray > sumOfArrayIndices) &&
-                    (chooseArray < (sumOfArrayIndices + score)))
-                {
-                    aSkeleton->setMark();
-                    sumOfArrayIndices += score;
-                    lSelection->push_back(aSkeleton);
-                    ++ii;
-                }
-                else
-                {
-                    sumOfArrayIndices += score;
-                }
-            }
-        }
-#else // ! defined(USE_SKELETON_)
-        for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-             ++walker)
-        {
-            Body * aBody = *walker;
-            
-            if (aBody && (! aBody->isMarked()))
-            {
-                realType score = aBody->getFitnessScore();
-                
-                if ((chooseArray > sumOfArrayIndices) &&
-                    (chooseArray < (sumOfArrayIndices + score)))
-                {
-                    aBody->setMark();
-                    sumOfArrayIndices += score;
-                    lSelection->push_back(aBody);
-                    ++ii;
-                }
-                else
-                {
-                    sumOfArrayIndices += score;
-                }
-            }
-        }
-#endif // ! defined(USE_SKELETON_)
+        printNewObject(*walker);
     }
-} // makeSelection
+} // printInitialPopulation
 
-#if defined(USE_FRACTION_FOR_CROSSOVER_)
-/*! @brief Generate a new set of objects, using the selected parents.
- @param crossoverFraction The proportion of objects to be generated. */
+/*! @brief Newly created poses are not printed. */
+template <typename CrossoverPolicy>
 static void
-doCrossovers(const realType crossoverFraction)
-#else // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-/*! @brief Generate a new set of objects, using the selected parents.
- @param crossoverCount The number of objects to be generated. */
+printInitialPopulation(const BatchEvolver<CrossoverPolicy> & )
+{
+} // printInitialPopulation
+
+/*! @brief Print the objects of the final selection.
+ @param anEvolver The engine holding the final selection.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+template <typename Genome,
+          typename CrossoverPolicy>
 static void
-doCrossovers(const size_t crossoverCount)
-#endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
+printFinalSelection(const Evolver<Genome, CrossoverPolicy> & anEvolver,
+                    const IndexVector &                      indices)
 {
-#if defined(PRINT_VALUES_)
-    std::cout << "Doing crossovers." << std::endl;
-#endif // defined(PRINT_VALUES_)
-    // We have an initial population, from the previous generation, and we will create two new
-    // 'children' for each parent pair.
-    // Remove all the objects that are not propagating forward, which are unmarked - the selection
-    // vector has pointers to the marked ones.
-#if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
+    const typename Evolver<Genome, CrossoverPolicy>::Population & population =
+                                                                    anEvolver.getPopulation();
+    const IndividualIndexVector &                                 selection =
+                                                                    anEvolver.getSelection();
+    
+    for (IndividualIndexVector::const_iterator walker(selection.begin());
+         selection.end() != walker; ++walker)
     {
-        Skeleton * aSkeleton = *walker;
-        
-        if (aSkeleton && (! aSkeleton->isMarked()))
-        {
-            delete aSkeleton;
-        }
+        printSelectedObject(population[*walker], indices);
     }
-#else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
+} // printFinalSelection
+
+/*! @brief Print the poses of the final selection.
+ @param anEvolver The engine holding the final selection.
+ @param indices The mapping from displayed angles to Skeleton angles. */
+template <typename CrossoverPolicy>
+static void
+printFinalSelection(const BatchEvolver<CrossoverPolicy> & anEvolver,
+                    const IndexVector &                   indices)
+{
+    const PoseBatch &       population = anEvolver.getPopulation();
+    const PoseIndexVector & selection = anEvolver.getSelection();
+    
+    for (PoseIndexVector::const_iterator walker(selection.begin()); selection.end() != walker;
          ++walker)
     {
-        Body * aBody = *walker;
-        
-        if (aBody && (! aBody->isMarked()))
-        {
-            delete aBody;
-        }
+        std::cout << "Final Selection:" << std::endl;
+        printSkeleton(population, *walker, indices);
     }
-#endif // ! defined(USE_SKELETON_)
-    *lPopulation = *lSelection;
-    // Clear the marks!
-#if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
+} // printFinalSelection
+
+/*! @brief Evolve a population with an engine and report the final selection.
+ @param indices The mapping from displayed angles to Skeleton angles.
+ @param cache The cache used to look up fitness values, or @c nullptr if there is none.
+ @param publisher The source of published fitness coefficients, or @c nullptr if there is none.
+ @param reportTimes @c true if the time spent in each phase is to be reported.
+ @param reportCounters @c true if the hardware performance counters are to be reported.
+ @param reportAllocations @c true if the memory allocations are to be reported.
+ @param reportStatistics @c true if a summary of the population is to be reported each
+ generation. */
+template <typename Engine>
+static void
+runEngine(const IndexVector & indices,
+          FitnessCache *      cache,
+          ProfilePublisher *  publisher,
+          const bool          reportTimes,
+          const bool          reportCounters,
+          const bool          reportAllocations,
+          const bool          reportStatistics)
+{
+    Engine anEvolver;
+    
+    anEvolver.setInstrumentationEnabled(reportTimes);
+    anEvolver.setAllocationAccountingEnabled(reportAllocations);
+    if (reportStatistics)
     {
-        Skeleton * aSkeleton = *walker;
-        
-        if (aSkeleton)
-        {
-            aSkeleton->clearMark();
-        }
+        anEvolver.setStatisticsCallback([] (const GenerationStatistics & statistics)
+                                        {
+                                            ReportGenerationStatistics(std::cerr, statistics);
+                                        });
     }
-#else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
+    // The counters must be enabled before the fitness threads are created, so that they count
+    // the work done by those threads.
+    if (reportCounters && (! anEvolver.setPerformanceCountersEnabled(true)))
     {
-        Body * aBody = *walker;
-        
-        if (aBody)
-        {
-            aBody->clearMark();
-        }
+        std::cerr << "Performance counters are not available; they will not be reported." <<
+                    std::endl;
     }
-#endif // ! defined(USE_SKELETON_)
-    for (bool keepGoing = true; keepGoing; )
+    anEvolver.setWorkerCount(kWorkerCount);
+    anEvolver.setFitnessCache(cache);
+    anEvolver.setProfilePublisher(publisher);
+#if defined(PRINT_VALUES_)
+    std::cout << "Generating " << anEvolver.populationSize.getValue() << " objects." << std::endl;
+#endif // defined(PRINT_VALUES_)
+    anEvolver.init();
+#if defined(PRINT_VALUES_)
+    printInitialPopulation(anEvolver);
+#endif // defined(PRINT_VALUES_)
+    for (size_t kk = 0; kIterationCount > kk; ++kk)
     {
-        // Pick two 'parent' objects:
-        size_t popSize = lPopulation->size();
-        size_t firstChoice = RandUnsignedInRange(popSize - 1);
-        size_t secondChoice;
-        
-        for ( ; ; )
-        {
-            secondChoice = RandUnsignedInRange(popSize - 1);
-            if (firstChoice != secondChoice)
-            {
-                break;
-            }
-            
-        }
-#if defined(USE_SKELETON_)
-        Skeleton * firstParent = (*lPopulation)[firstChoice];
-        Skeleton * secondParent = (*lPopulation)[secondChoice];
-#else // ! defined(USE_SKELETON_)
-        Body *     firstParent = (*lPopulation)[firstChoice];
-        Body *     secondParent = (*lPopulation)[secondChoice];
-#endif // ! defined(USE_SKELETON_)
-        
-        if (firstParent && secondParent)
-        {
-#if defined(USE_SKELETON_)
-            Skeleton * firstChild = new Skeleton(*firstParent);
-            Skeleton * secondChild = new Skeleton(*secondParent);
-#else // ! defined(USE_SKELETON_)
-            Body *     firstChild = new Body(*firstParent);
-            Body *     secondChild = new Body(*secondParent);
-#endif // ! defined(USE_SKELETON_)
-            
-            // Crossover attributes:
-            lPopulation->push_back(firstChild);
-            lPopulation->push_back(secondChild);
-#if defined(USE_FRACTION_FOR_CROSSOVER_)
-            firstChild->swapValues(*secondChild, crossoverFraction);
-#else // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-            firstChild->swapValues(*secondChild, crossoverCount);
-#endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-            if (kPopulationSize <= lPopulation->size())
-            {
-                keepGoing = false;
-            }
-        }
+#if defined(PRINT_VALUES_)
+        std::cout << "Producing generation " << (kk + 1) << "." << std::endl;
+#endif // defined(PRINT_VALUES_)
+        anEvolver.step();
     }
-} // doCrossovers
-
-/*! @brief Mutate some of the objects.
- @param mutationFraction The proportion of objects to be mutated. */
-static void
-doMutations(const realType mutationFraction)
-{
 #if defined(PRINT_VALUES_)
-    std::cout << "Doing mutations." << std::endl;
+    std::cout << "Making final selection." << std::endl;
+#endif // defined(PRINT_VALUES_)
+    anEvolver.finalSelection(kFinalSelectionSize);
+#if defined(PRINT_VALUES_)
+    printFinalSelection(anEvolver, indices);
 #endif // defined(PRINT_VALUES_)
-    // Mark the objects to be mutated:
-    for (size_t ii = 0, jmax = lPopulation->size(),
-         imax = static_cast<size_t>(mutationFraction * jmax); imax > ii;)
+    if (reportTimes)
     {
-        size_t jj = RandUnsignedInRange(jmax - 1);
-#if defined(USE_SKELETON_)
-        Skeleton * aSkeleton = (*lPopulation)[jj];
-#else // ! defined(USE_SKELETON_)
-        Body *     aBody = (*lPopulation)[jj];
-#endif // ! defined(USE_SKELETON_)
-        
-#if defined(USE_SKELETON_)
-        if (aSkeleton && (! aSkeleton->isMarked()))
-        {
-            aSkeleton->setMark();
-            ++ii;
-        }
-#else // ! defined(USE_SKELETON_)
-        if (aBody && (! aBody->isMarked()))
-        {
-            aBody->setMark();
-            ++ii;
-        }
-#endif // ! defined(USE_SKELETON_)
+        anEvolver.getPhaseStatistics().report(std::cerr);
+        std::cerr << "Skipped evaluations: " << (anEvolver.getSkippedEvaluationRatio() * 100) <<
+                    "%" << std::endl;
     }
-#if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
+    if (anEvolver.getPerformanceCounters())
     {
-        Skeleton * aSkeleton = *walker;
-        
-        if (aSkeleton && aSkeleton->isMarked())
-        {
-            aSkeleton->mutate();
-            aSkeleton->clearMark();
-        }
+        anEvolver.getPerformanceCounters()->report(std::cerr, anEvolver.getCounterSamples());
     }
-#else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker; ++walker)
+    if (reportAllocations)
     {
-        Body * aBody = *walker;
-        
-        if (aBody && aBody->isMarked())
-        {
-            aBody->mutate();
-            aBody->clearMark();
-        }
+        // The samples are kept when accounting stops, and the report is no longer counted.
+        anEvolver.setAllocationAccountingEnabled(false);
+        ReportAllocationSamples(std::cerr, anEvolver.getAllocationSamples());
     }
-#endif // ! defined(USE_SKELETON_)
-} // doMutations
-
-/*! @brief Make the final selections. */
+} // runEngine
+
+/*! @brief Evolve a population with the engine of the requested kind.
+ @param kind The kind of engine to run.
+ @param indices The mapping from displayed angles to Skeleton angles.
+ @param cache The cache used to look up fitness values, or @c nullptr if there is none.
+ @param publisher The source of published fitness coefficients, or @c nullptr if there is none.
+ @param reportTimes @c true if the time spent in each phase is to be reported.
+ @param reportCounters @c true if the hardware performance counters are to be reported.
+ @param reportAllocations @c true if the memory allocations are to be reported.
+ @param reportStatistics @c true if a summary of the population is to be reported each
+ generation. */
+template <typename CrossoverPolicy>
 static void
-makeFinalSelection(const size_t selectionSize)
+runEngineOfKind(const EngineKind    kind,
+                const IndexVector & indices,
+                FitnessCache *      cache,
+                ProfilePublisher *  publisher,
+                const bool          reportTimes,
+                const bool          reportCounters,
+                const bool          reportAllocations,
+                const bool          reportStatistics)
 {
-#if defined(PRINT_VALUES_)
-    std::cout << "Making final selection." << std::endl;
-#endif // defined(PRINT_VALUES_)
-    realType sumOfScore = 0;
-    
-#if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
-    {
-        Skeleton * aSkeleton = *walker;
-        
-        if (aSkeleton)
-        {
-            sumOfScore += aSkeleton->getFitnessScore();
-        }
-    }
-#else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-         ++walker)
-    {
-        Body * aBody = *walker;
-        
-        if (aBody)
-        {
-            sumOfScore += aBody->getFitnessScore();
-        }
-    }
-#endif // ! defined(USE_SKELETON_)
-    lSelection->clear();
-    lSelection->resize(selectionSize);
-    for (size_t ii = 0, imax = selectionSize; imax > ii; )
+    switch (kind)
     {
-        realType sumOfArrayIndices = 0;
-        realType chooseArray = RandRealInRange(0, sumOfScore);
-        
-#if defined(USE_SKELETON_)
-        for (SkeletonVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-             ++walker)
-        {
-            Skeleton * aSkeleton = *walker;
+        case kEngineBatch :
+            runEngine<BatchEvolver<CrossoverPolicy> >(indices, cache, publisher, reportTimes,
+                                                      reportCounters, reportAllocations,
+                                                      reportStatistics);
+            break;
             
-            if (aSkeleton)
-            {
-                realType score = aSkeleton->getFitnessScore();
-                
-                if ((chooseArray > sumOfArrayIndices) &&
-                    (chooseArray < (sumOfArrayIndices + score)))
-                {
-                    sumOfArrayIndices += score;
-                    (*lSelection)[ii] = aSkeleton;
-                    ++ii;
-                }
-                else
-                {
-                    sumOfArrayIndices += score;
-                }
-            }
-        }
-#else // ! defined(USE_SKELETON_)
-        for (BodyVector::iterator walker(lPopulation->begin()); lPopulation->end() != walker;
-             ++walker)
-        {
-            Body * aBody = *walker;
+        case kEngineBinarySkeleton :
+            runEngine<Evolver<BinarySkeleton, CrossoverPolicy> >(indices, cache, publisher,
+                                                                 reportTimes, reportCounters,
+                                                                 reportAllocations,
+                                                                 reportStatistics);
+            break;
+            
+        case kEnginePackedSkeleton :
+            runEngine<Evolver<PackedSkeleton, CrossoverPolicy> >(indices, cache, publisher,
+                                                                 reportTimes, reportCounters,
+                                                                 reportAllocations,
+                                                                 reportStatistics);
+            break;
+            
+        case kEngineBody :
+            runEngine<Evolver<Body, CrossoverPolicy> >(indices, cache, publisher, reportTimes,
+                                                       reportCounters, reportAllocations,
+                                                       reportStatistics);
+            break;
+            
+        case kEnginePositionedBody :
+            runEngine<Evolver<PositionedBody, CrossoverPolicy> >(indices, cache, publisher,
+                                                                 reportTimes, reportCounters,
+                                                                 reportAllocations,
+                                                                 reportStatistics);
+            break;
+            
+        case kEngineSkeleton :
+            runEngine<Evolver<Skeleton, CrossoverPolicy> >(indices, cache, publisher, reportTimes,
+                                                           reportCounters, reportAllocations,
+                                                           reportStatistics);
+            break;
             
-            if (aBody)
-            {
-                realType score = aBody->getFitnessScore();
-                
-                if ((chooseArray > sumOfArrayIndices) &&
-                    (chooseArray < (sumOfArrayIndices + score)))
-                {
-                    sumOfArrayIndices += score;
-                    (*lSelection)[ii] = aBody;
-                    ++ii;
-                }
-                else
-                {
-                    sumOfArrayIndices += score;
-                }
-            }
-        }
-#endif // ! defined(USE_SKELETON_)
     }
-} // makeFinalSelection
+} // runEngineOfKind
 
 #if defined(__APPLE__)
 # pragma mark Class methods
@@ -812,131 +560,182 @@ makeFinalSelection(const size_t selectionSize)
 
 /*! @brief The entry point for calculating the movement parameter vectors.
  
- Standard output will receive a list of the movement parameter vectors.
+ Standard output will receive a list of the movement parameter vectors. The optional arguments
+ select the kind of engine - 'skeleton' (the default), 'batch', 'binary', 'packed', 'body' or
+ 'positioned' - and how the number of attributes to swap is determined - 'count' (the default)
+ or 'fraction'. A fitness cache is used with the argument 'cache', held in memory, or
+ 'cache=' followed by the path to a file that holds the cache from one run to the next. The
+ argument 'profile=' followed by the path to a file of fitness coefficients publishes the
+ coefficients to the engine each time the file changes. With the argument 'times', the time
+ spent in each phase of the engine and the rates of work are written to standard error. The
+ argument 'trace=' followed by a path writes a timeline of the engine's phases to that file, in
+ the Chrome trace event format. On Linux, the argument 'counters' writes the changes in the
+ hardware performance counters over each phase of each generation to standard error, and the
+ argument 'allocations' writes the memory allocations made during each phase of each generation
+ to standard error. With the argument 'stats', a summary of the population - the spread of the
+ fitness values, the number of objects in each fitness class and the diversity of the angles -
+ is written to standard error after each generation.
  @param argc The number of arguments in 'argv'.
  @param argv The arguments to be used with the application.
  @returns @c 0 on a successful test and @c 1 on failure. */
-#if (! defined(__APPLE__))
-# pragma warning(push)
-# pragma warning(disable: 4100)
-#endif // ! defined(__APPLE__)
 int
 main(int            argc,
      const char * * argv)
 {
-#if defined(__APPLE__)
-# pragma unused(argc, argv)
-#endif // defined(__APPLE__)
-#if defined(REPORT_TIMES_)
-    double timeBeforeFitness;
-    double timeBeforeSelection;
-    double timeBeforeCrossovers;
-    double timeBeforeMutations;
-    double timeBeforeFinalSelection;
-    double timeAfterFinalSelection;
-    double timeAfterMutations;
-    double fitnessTime = 0;
-    double selectionTime = 0;
-    double crossoverTime = 0;
-    double mutationTime = 0;
-    double iterationTime = 0;
-    double finalSelectionTime;
-#endif // defined(REPORT_TIMES_)
+    EngineKind         kind = kEngineSkeleton;
+    bool               reportAllocations = false;
+    bool               reportCounters = false;
+    bool               reportStatistics = false;
+    bool               reportTimes = false;
+    bool               useCache = false;
+    bool               useFraction = false;
+    bool               okSoFar = true;
+    IndexVector        indices;
+    std::string        cachePath;
+    std::string        profilePath;
+    std::string        tracePath;
+    FitnessCache *     cache = nullptr;
+    ProfilePublisher * publisher = nullptr;
+    ProfileWatcher *   watcher = nullptr;
     
-#if defined(USE_SKELETON_)
-    lPopulation = new SkeletonVector;
-    lSelection = new SkeletonVector;
-    lIndices = new IndexVector;
-    generateSkeletons(kPopulationSize);
-    createMapForAngles();
-#else // ! defined(USE_SKELETON_)
-    lPopulation = new BodyVector;
-    lSelection = new BodyVector;
-    generateBodies(kPopulationSize);
-#endif // ! defined(USE_SKELETON_)
-    for (size_t kk = 0; kIterationCount > kk; ++kk)
+    for (int ii = 1; okSoFar && (argc > ii); ++ii)
     {
-#if defined(REPORT_TIMES_)
-        timeBeforeFitness = getMillisecondsSinceEpoch();
-#endif // defined(REPORT_TIMES_)
-        calculateFitnessValues();
-#if defined(REPORT_TIMES_)
-        timeBeforeSelection = getMillisecondsSinceEpoch();
-#endif // defined(REPORT_TIMES_)
-        makeSelection();
-#if defined(REPORT_TIMES_)
-        timeBeforeCrossovers = getMillisecondsSinceEpoch();
-#endif // defined(REPORT_TIMES_)
-#if defined(USE_FRACTION_FOR_CROSSOVER_)
-        doCrossovers(kCrossoverFraction);
-#else // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-        doCrossovers(kCrossoverCount);
-#endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-#if defined(REPORT_TIMES_)
-        timeBeforeMutations = getMillisecondsSinceEpoch();
-#endif // defined(REPORT_TIMES_)
-        doMutations(kMutationFraction);
-#if defined(REPORT_TIMES_)
-        timeAfterMutations = getMillisecondsSinceEpoch();
-        fitnessTime += (timeBeforeSelection - timeBeforeFitness);
-        selectionTime += (timeBeforeCrossovers - timeBeforeSelection);
-        crossoverTime += (timeBeforeMutations - timeBeforeCrossovers);
-        mutationTime += (timeAfterMutations - timeBeforeMutations);
-        iterationTime += (timeAfterMutations - timeBeforeFitness);
-#endif // defined(REPORT_TIMES_)
-    }
-    calculateFitnessValues();
-#if defined(REPORT_TIMES_)
-    timeBeforeFinalSelection = getMillisecondsSinceEpoch();
-#endif // defined(REPORT_TIMES_)
-    makeFinalSelection(kFinalSelectionSize);
-#if defined(REPORT_TIMES_)
-    timeAfterFinalSelection = getMillisecondsSinceEpoch();
-#endif // defined(REPORT_TIMES_)
-#if defined(PRINT_VALUES_)
-# if defined(USE_SKELETON_)
-    for (SkeletonVector::iterator walker(lSelection->begin()); lSelection->end() != walker;
-         ++walker)
-    {
-        Skeleton * aSkeleton = *walker;
+        std::string anArg(argv[ii]);
         
-        if (aSkeleton)
+        if ("batch" == anArg)
+        {
+            kind = kEngineBatch;
+        }
+        else if ("binary" == anArg)
+        {
+            kind = kEngineBinarySkeleton;
+        }
+        else if ("packed" == anArg)
+        {
+            kind = kEnginePackedSkeleton;
+        }
+        else if ("body" == anArg)
+        {
+            kind = kEngineBody;
+        }
+        else if ("positioned" == anArg)
+        {
+            kind = kEnginePositionedBody;
+        }
+        else if ("skeleton" == anArg)
+        {
+            kind = kEngineSkeleton;
+        }
+        else if ("count" == anArg)
+        {
+            useFraction = false;
+        }
+        else if ("fraction" == anArg)
+        {
+            useFraction = true;
+        }
+        else if ("cache" == anArg)
+        {
+            useCache = true;
+            cachePath.clear();
+        }
+        else if (0 == anArg.compare(0, 6, "cache="))
+        {
+            useCache = true;
+            cachePath = anArg.substr(6);
+        }
+        else if (0 == anArg.compare(0, 8, "profile="))
+        {
+            profilePath = anArg.substr(8);
+        }
+        else if ("allocations" == anArg)
+        {
+            reportAllocations = true;
+        }
+        else if ("counters" == anArg)
+        {
+            reportCounters = true;
+        }
+        else if ("stats" == anArg)
+        {
+            reportStatistics = true;
+        }
+        else if ("times" == anArg)
+        {
+            reportTimes = true;
+        }
+        else if (0 == anArg.compare(0, 6, "trace="))
+        {
+            tracePath = anArg.substr(6);
+        }
+        else
         {
-            std::cout << "Final Selection:" << std::endl;
-            printSkeleton(*aSkeleton);
+            std::cerr << "Unrecognized argument '" << anArg << "'." << std::endl;
+            std::cerr << "Usage: " << argv[0] <<
+                        " [skeleton | batch | binary | packed | body | positioned] " <<
+                        "[count | fraction] [cache | cache=path] [profile=path] [times] " <<
+                        "[counters] [allocations] [stats] [trace=path]" << std::endl;
+            okSoFar = false;
         }
     }
-# else // ! defined(USE_SKELETON_)
-    for (BodyVector::iterator walker(lSelection->begin()); lSelection->end() != walker;
-         ++walker)
+    if (okSoFar)
     {
-        Body * aBody = *walker;
-        
-        if (aBody)
+        createMapForAngles(indices);
+        if (useCache)
+        {
+            if (cachePath.empty())
+            {
+                cache = new FitnessCache(kFitnessCacheCapacity);
+            }
+            else
+            {
+                cache = new FitnessCache(kFitnessCacheCapacity, cachePath);
+                if (! cache->isMapped())
+                {
+                    std::cerr << "Could not map '" << cachePath << "'; the fitness cache will " <<
+                                "not be kept." << std::endl;
+                }
+            }
+        }
+        if (! profilePath.empty())
         {
-            std::cout << "Final Selection: ";
-            printBody(*aBody);
+            publisher = new ProfilePublisher;
+            watcher = new ProfileWatcher(*publisher, profilePath);
+            if (0 == publisher->getVersion())
+            {
+                std::cerr << "Could not read '" << profilePath << "'; the initial fitness " <<
+                            "coefficients will be used until it can be read." << std::endl;
+            }
         }
-    }
-# endif // ! defined(USE_SKELETON_)
+        EnableTracing(! tracePath.empty());
+        if (useFraction)
+        {
+            runEngineOfKind<CrossoverByFraction>(kind, indices, cache, publisher, reportTimes,
+                                                 reportCounters, reportAllocations,
+                                                 reportStatistics);
+        }
+        else
+        {
+            runEngineOfKind<CrossoverByCount>(kind, indices, cache, publisher, reportTimes,
+                                              reportCounters, reportAllocations,
+                                              reportStatistics);
+        }
+        if (! tracePath.empty())
+        {
+            std::ofstream traceStream(tracePath.c_str());
+            
+            WriteTraceEvents(traceStream);
+            if (! traceStream)
+            {
+                std::cerr << "Could not write '" << tracePath << "'." << std::endl;
+            }
+        }
+        delete watcher;
+        delete publisher;
+        delete cache;
+#if defined(PRINT_VALUES_)
+        std::cout << "Cleaning up." << std::endl;
 #endif // defined(PRINT_VALUES_)
-#if defined(REPORT_TIMES_)
-    finalSelectionTime = (timeAfterFinalSelection - timeBeforeFinalSelection);
-    std::cerr << "Final selection time: " << finalSelectionTime << " msec" << std::endl;
-    std::cerr << "Fitness time: " << fitnessTime << " (" << (fitnessTime / kIterationCount) <<
-                ") msec" << std::endl;
-    std::cerr << "Selection time: " << selectionTime << " (" << (selectionTime / kIterationCount) <<
-                ") msec" << std::endl;
-    std::cerr << "Crossover time: " << crossoverTime << " (" << (crossoverTime / kIterationCount) <<
-                ") msec" << std::endl;
-    std::cerr << "Mutation time: " << mutationTime << " (" << (mutationTime / kIterationCount) <<
-                ") msec" << std::endl;
-    std::cerr << "Iteration time: " << iterationTime << " (" << (iterationTime / kIterationCount) <<
-                ") msec" << std::endl;
-#endif // defined(REPORT_TIMES_)
-    cleanup();
-    return 0;
+    }
+    return (okSoFar ? 0 : 1);
 } // main
-#if (! defined(__APPLE__))
-# pragma warning(pop)
-#endif // ! defined(__APPLE__)
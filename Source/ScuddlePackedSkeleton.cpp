@@ -0,0 +1,285 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePackedSkeleton.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for PackedSkeleton objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddlePackedSkeleton.h"
+
+#include "ScuddleFitnessTables.h"
+
+#include <type_traits>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for PackedSkeleton objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+// Populations of PackedSkeleton objects are copied and moved around as plain storage.
+static_assert(std::is_trivially_copyable<PackedSkeleton>::value,
+              "PackedSkeleton objects must be trivially copyable");
+
+// The point of a PackedSkeleton is its size; catch any member that would make it grow.
+static_assert(24 >= sizeof(PackedSkeleton), "PackedSkeleton objects must fit in 24 bytes");
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PackedSkeleton::PackedSkeleton(void) :
+    PackedSkeleton(BinarySkeleton())
+{
+} // PackedSkeleton::PackedSkeleton
+
+PackedSkeleton::PackedSkeleton(RandomGenerator & generator) :
+    PackedSkeleton(BinarySkeleton(generator))
+{
+} // PackedSkeleton::PackedSkeleton
+
+PackedSkeleton::PackedSkeleton(const BinarySkeleton & other) :
+    _accumulatedScore(other.getFitnessScore()),
+    _traits(packTraits(other.getFlow(), other.getHeight(), other.getSpace(), other.getTime(),
+                       other.getWeight())),
+    _bartenieffClass(other.getFitnessFactors().bartenieffClass),
+    _quadrantScore(other.getFitnessFactors().quadrantScore)
+{
+    for (size_t ii = 0; kNumCalculatedAngles > ii; ++ii)
+    {
+        _angles[ii] = other.getBinaryAngle(ii);
+    }
+} // PackedSkeleton::PackedSkeleton
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+realType
+PackedSkeleton::getAngle(const size_t index)
+const
+{
+    realType result;
+    
+    if (kNumCalculatedAngles > index)
+    {
+        result = BinaryAngleToRadians(_angles[index]);
+    }
+    else
+    {
+        result = 0;
+    }
+    return result;
+} // PackedSkeleton::getAngle
+
+realType
+PackedSkeleton::getAngleAsDegrees(const size_t index)
+const
+{
+    realType result;
+    
+    if (kNumCalculatedAngles > index)
+    {
+        result = BinaryAngleToDegrees(_angles[index]);
+    }
+    else
+    {
+        result = RadiansToDegrees(RandomAngle(360));
+    }
+    return result;
+} // PackedSkeleton::getAngleAsDegrees
+
+glm::quat
+PackedSkeleton::getAngleAsQuaternion(const size_t index)
+const
+{
+    realType angle;
+    
+    if (kNumCalculatedAngles > index)
+    {
+        angle = BinaryAngleToRadians(_angles[index]);
+    }
+    else
+    {
+        angle = RandomAngle(360);
+    }
+    return glm::quat_cast(glm::rotate(glm::mat4(1), angle, glm::vec3(0, 0, 1)));
+} // PackedSkeleton::getAngleAsQuaternion
+
+uint64_t
+PackedSkeleton::getAttributeHash(void)
+const
+{
+    return BinarySkeleton::calculateHash(_angles, getFlow(), getHeight(), getSpace(), getTime(),
+                                         getWeight());
+} // PackedSkeleton::getAttributeHash
+
+FitnessFactors
+PackedSkeleton::getFitnessFactors(void)
+const
+{
+    // Only the classes that cannot be recovered from the traits are stored.
+    const FitnessTables & tables = GetFitnessTables();
+    FitnessFactors        result;
+    
+    result.bartenieffClass = _bartenieffClass;
+    result.effortClass = tables.effortClasses[EffortCode(getWeight(), getSpace(), getTime(),
+                                                         getFlow())];
+    result.heightClass = (tables.bentLegs[getHeight()] ? kHeightClassUnextendedLegs :
+                          kHeightClassNone);
+    result.quadrantScore = _quadrantScore;
+    return result;
+} // PackedSkeleton::getFitnessFactors
+
+void
+PackedSkeleton::mutate(RandomGenerator & generator)
+{
+    size_t whichAngle = generator.nextUnsigned(kNumCalculatedAngles - 1);
+    
+    switch (whichAngle)
+    {
+        case Skeleton::kLeftShoulderToElbow :
+        case Skeleton::kRightShoulderToElbow :
+        case Skeleton::kLeftHipToKnee :
+        case Skeleton::kRightHipToKnee :
+            _angles[whichAngle] = RandomBinaryAngle(generator, 360);
+            break;
+            
+        case Skeleton::kLeftElbowToWrist :
+        case Skeleton::kRightElbowToWrist :
+        case Skeleton::kLeftKneeToFoot :
+        case Skeleton::kRightKneeToFoot :
+            _angles[whichAngle] = RandomBinaryAngle(generator, 180);
+            break;
+            
+        default :
+            break;
+            
+    }
+} // PackedSkeleton::mutate
+
+void
+PackedSkeleton::swapValues(PackedSkeleton &  other,
+                           const size_t      numSwap,
+                           RandomGenerator & generator)
+{
+    size_t realSwap;
+    
+    if (kNumAttributes < numSwap)
+    {
+        realSwap = kNumAttributes;
+    }
+    else
+    {
+        realSwap = numSwap;
+    }
+    // Collect a set of distinct indices to swap, one bit per attribute; the first four are the
+    // Effort qualities, in the same order as their bits, followed by the Height level and then
+    // the angles.
+    uint32_t chosen = 0;
+    size_t   numChosen = 0;
+    
+    do
+    {
+        uint32_t aBit = (1U << generator.nextUnsigned(kNumAttributes - 1));
+        
+        if (0 == (chosen & aBit))
+        {
+            chosen |= aBit;
+            ++numChosen;
+        }
+    }
+    while (realSwap > numChosen);
+    // Exchange the chosen bits of the two objects, without touching the marks.
+    uint8_t traitMask = static_cast<uint8_t>((chosen & kEffortMask) |
+                                             ((0 - ((chosen >> (kNumFixedAttributes - 1)) & 1)) &
+                                              kHeightMask));
+    uint8_t traitDifference = static_cast<uint8_t>((_traits ^ other._traits) & traitMask);
+    
+    _traits ^= traitDifference;
+    other._traits ^= traitDifference;
+    // Each angle is either exchanged completely or not at all; there are no branches, so this
+    // loop can be done as a single vector operation.
+    for (size_t ii = 0; kNumCalculatedAngles > ii; ++ii)
+    {
+        BinaryAngle angleMask = static_cast<BinaryAngle>(0 - ((chosen >>
+                                                               (ii + kNumFixedAttributes)) & 1));
+        BinaryAngle angleDifference = static_cast<BinaryAngle>((_angles[ii] ^ other._angles[ii]) &
+                                                               angleMask);
+        
+        _angles[ii] ^= angleDifference;
+        other._angles[ii] ^= angleDifference;
+    }
+} // PackedSkeleton::swapValues
+
+bool
+PackedSkeleton::updateFitness(const FitnessCoefficients & coefficients)
+{
+    setFitnessFactors(BinarySkeleton::calculateFactors(_angles, getFlow(), getHeight(), getSpace(),
+                                                       getTime(), getWeight()));
+    rescoreFitness(coefficients);
+    return true;
+} // PackedSkeleton::updateFitness
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,373 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePackedSkeleton.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for PackedSkeleton objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_PackedSkeleton_H_))
+# define Scuddle_PackedSkeleton_H_ /* Header guard */
+
+# include "ScuddleBinarySkeleton.h"
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for PackedSkeleton objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief The Scuddle PackedSkeleton structure.
+     
+     A PackedSkeleton has the same attributes and fitness rules as a BinarySkeleton, but is packed
+     into 24 bytes, so that very large populations can be held in memory: the angles are binary
+     angles, and the Effort qualities, the Height level and the mark share a single byte. The
+     Effort qualities occupy the low nibble, in the same order as the attributes that are swapped
+     by swapValues, followed by three bits for the Height level and one bit for the mark. */
+    class PackedSkeleton
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The attributes are set using the random number generator for the calling thread. */
+        PackedSkeleton(void);
+        
+        /*! @brief The constructor.
+         
+         The attributes are set as for a BinarySkeleton, so that the same generator produces the
+         same attributes.
+         @param generator The random number generator used to set the attributes. */
+        explicit
+        PackedSkeleton(RandomGenerator & generator);
+        
+        /*! @brief The constructor.
+         @param other The BinarySkeleton whose attributes are to be packed. */
+        explicit
+        PackedSkeleton(const BinarySkeleton & other);
+        
+        /*! @brief The copy constructor.
+         @param other The PackedSkeleton to be copied. */
+        PackedSkeleton(const PackedSkeleton & other) = default;
+        
+        /*! @brief The move constructor.
+         @param other The PackedSkeleton to be moved. */
+        PackedSkeleton(PackedSkeleton && other) = default;
+        
+        /*! @brief The destructor. */
+        ~PackedSkeleton(void) = default;
+        
+        /*! @brief Unmark the object. */
+        void
+        clearMark(void)
+        {
+            _traits = static_cast<uint8_t>(_traits & ~kMarkBit);
+        } // clearMark
+        
+        /*! @brief Return a specific angle (in radians).
+         @param index The index of the angle to be returned.
+         @returns The specified angle, in radians. */
+        realType
+        getAngle(const size_t index)
+        const;
+        
+        /*! @brief Return a specific angle (in degrees).
+         @param index The index of the angle to be returned.
+         @returns The specified angle, in degrees. */
+        realType
+        getAngleAsDegrees(const size_t index)
+        const;
+        
+        /*! @brief Return a specific angle as a quaternion.
+         @param index The index of the angle to be returned.
+         @returns The specified angle as a quaternion. */
+        glm::quat
+        getAngleAsQuaternion(const size_t index)
+        const;
+        
+        /*! @brief Return a hash of the attributes that determine the fitness value.
+         @returns A hash of the attributes that determine the fitness value. */
+        uint64_t
+        getAttributeHash(void)
+        const;
+        
+        /*! @brief Return a specific angle, as it is stored.
+         @param index The index of the angle to be returned.
+         @returns The specified angle. */
+        BinaryAngle
+        getBinaryAngle(const size_t index)
+        const
+        {
+            return _angles[index];
+        } // getBinaryAngle
+        
+        /*! @brief Return the factors found by the last evaluation.
+         
+         Only the Bartenieff class and the quadrant score are stored; the other factors are
+         looked up from the Effort qualities and the Height level.
+         @returns The factors found by the last evaluation. */
+        FitnessFactors
+        getFitnessFactors(void)
+        const;
+        
+        /*! @brief Return the calculated fitness score.
+         @returns The calculated fitness score. */
+        realType
+        getFitnessScore(void)
+        const
+        {
+            return _accumulatedScore;
+        } // getFitnessScore
+        
+        /*! @brief Return the Flow Quality.
+         @returns The Flow Quality value. */
+        FlowQuality
+        getFlow(void)
+        const
+        {
+            return ((_traits & kFlowBit) ? kFlowBound : kFlowFree);
+        } // getFlow
+        
+        /*! @brief Return the Height level.
+         @returns The Height level value. */
+        HeightValue
+        getHeight(void)
+        const
+        {
+            return static_cast<HeightValue>((_traits & kHeightMask) >> kHeightShift);
+        } // getHeight
+        
+        /*! @brief Return the number of angles.
+         @returns The number of angles. */
+        size_t
+        getNumAngles(void)
+        const
+        {
+            return kNumCalculatedAngles;
+        } // getNumAngles
+        
+        /*! @brief Return the Space Quality.
+         @returns The Space Quality value. */
+        SpaceQuality
+        getSpace(void)
+        const
+        {
+            return ((_traits & kSpaceBit) ? kSpaceDirect : kSpaceIndirect);
+        } // getSpace
+        
+        /*! @brief Return the Time Quality.
+         @returns The Time Quality value. */
+        TimeQuality
+        getTime(void)
+        const
+        {
+            return ((_traits & kTimeBit) ? kTimeSudden : kTimeSustained);
+        } // getTime
+        
+        /*! @brief Return the Weight Quality.
+         @returns The Weight Quality value. */
+        WeightQuality
+        getWeight(void)
+        const
+        {
+            return ((_traits & kWeightBit) ? kWeightStrong : kWeightLight);
+        } // getWeight
+        
+        /*! @brief Return @c true if the object is marked.
+         @returns @c true if the object is marked. */
+        bool
+        isMarked(void)
+        const
+        {
+            return (0 != (_traits & kMarkBit));
+        } // isMarked
+        
+        /*! @brief Mutate a value of the object.
+         @param generator The random number generator to use. */
+        void
+        mutate(RandomGenerator & generator);
+        
+        /*! @brief The assignment operator.
+         @param other The PackedSkeleton to be copied.
+         @returns The updated object. */
+        PackedSkeleton &
+        operator =(const PackedSkeleton & other) = default;
+        
+        /*! @brief The move assignment operator.
+         @param other The PackedSkeleton to be moved.
+         @returns The updated object. */
+        PackedSkeleton &
+        operator =(PackedSkeleton && other) = default;
+        
+        /*! @brief Pack a set of Effort qualities and a Height level into a single byte.
+         @param flow The Flow Quality value.
+         @param height The Height level value.
+         @param space The Space Quality value.
+         @param time The Time Quality value.
+         @param weight The Weight Quality value.
+         @returns The packed values, with the mark clear. */
+        static uint8_t
+        packTraits(const FlowQuality   flow,
+                   const HeightValue   height,
+                   const SpaceQuality  space,
+                   const TimeQuality   time,
+                   const WeightQuality weight)
+        {
+            return static_cast<uint8_t>(((kWeightStrong == weight) ? kWeightBit : 0) |
+                                        ((kSpaceDirect == space) ? kSpaceBit : 0) |
+                                        ((kTimeSudden == time) ? kTimeBit : 0) |
+                                        ((kFlowBound == flow) ? kFlowBit : 0) |
+                                        (static_cast<int>(height) << kHeightShift));
+        } // packTraits
+        
+        /*! @brief Recalculate the fitness value from the factors found by the last evaluation.
+         
+         The attributes must not have changed since the last evaluation.
+         @param coefficients The fitness coefficients to be applied. */
+        void
+        rescoreFitness(const FitnessCoefficients & coefficients)
+        {
+            _accumulatedScore = ScoreFitnessFactors(coefficients, getFitnessFactors());
+        } // rescoreFitness
+        
+        /*! @brief Set the factors to those found by a previous evaluation of the same
+         attributes.
+         
+         The fitness value is not changed; use rescoreFitness to apply the fitness coefficients.
+         @param factors The factors for the current attributes. */
+        void
+        setFitnessFactors(const FitnessFactors & factors)
+        {
+            _bartenieffClass = factors.bartenieffClass;
+            _quadrantScore = factors.quadrantScore;
+        } // setFitnessFactors
+        
+        /*! @brief Mark the object. */
+        void
+        setMark(void)
+        {
+            _traits = static_cast<uint8_t>(_traits | kMarkBit);
+        } // setMark
+        
+        /*! @brief Choose a set of values and swap with another PackedSkeleton.
+         
+         The values are chosen in the same way as for a BinarySkeleton, and then exchanged by
+         masking rather than one at a time, so that the angles are handled as a single vector.
+         @param other The other PackedSkeleton to be modified.
+         @param numSwap The number of values to be exchanged.
+         @param generator The random number generator to use. */
+        void
+        swapValues(PackedSkeleton &  other,
+                   const size_t      numSwap,
+                   RandomGenerator & generator);
+        
+        /*! @brief Determine the fitness value for this object.
+         
+         Every call evaluates the object completely.
+         @param coefficients The fitness coefficients to be applied.
+         @returns @c true, as the object is always evaluated. */
+        bool
+        updateFitness(const FitnessCoefficients & coefficients);
+        
+    protected :
+    
+    private :
+        
+    public :
+        
+        /*! @brief The number of angles in each PackedSkeleton. */
+        static const size_t kNumCalculatedAngles = Skeleton::kNumCalculatedAngles;
+        
+        /*! @brief The number of attributes in each PackedSkeleton that are not angles. */
+        static const size_t kNumFixedAttributes = Skeleton::kNumFixedAttributes;
+        
+        /*! @brief The number of attributes that can be swapped. */
+        static const size_t kNumAttributes = Skeleton::kNumAttributes;
+        
+    protected :
+    
+    private :
+        
+        /*! @brief The bit that is set for a strong Weight Quality. */
+        static const uint8_t kWeightBit = 0x01;
+        
+        /*! @brief The bit that is set for a direct Space Quality. */
+        static const uint8_t kSpaceBit = 0x02;
+        
+        /*! @brief The bit that is set for a sudden Time Quality. */
+        static const uint8_t kTimeBit = 0x04;
+        
+        /*! @brief The bit that is set for a bound Flow Quality. */
+        static const uint8_t kFlowBit = 0x08;
+        
+        /*! @brief The bits that hold the Effort qualities. */
+        static const uint8_t kEffortMask = 0x0F;
+        
+        /*! @brief The position of the Height level. */
+        static const int kHeightShift = 4;
+        
+        /*! @brief The bits that hold the Height level. */
+        static const uint8_t kHeightMask = 0x70;
+        
+        /*! @brief The bit that is set when the object has been marked. */
+        static const uint8_t kMarkBit = 0x80;
+        
+        /*! @brief The angles to be worked with. */
+        BinarySkeletonAngles _angles;
+        
+        /*! @brief The calculated fitness score. */
+        realType _accumulatedScore;
+        
+        /*! @brief The Effort qualities, the Height level and the mark. */
+        uint8_t _traits;
+        
+        /*! @brief The BartenieffClass found by the last evaluation. */
+        uint8_t _bartenieffClass;
+        
+        /*! @brief The quadrant score found by the last evaluation. */
+        uint8_t _quadrantScore;
+        
+    }; // PackedSkeleton
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_PackedSkeleton_H_) */
@@ -0,0 +1,180 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePageAllocator.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for PageAllocator objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_PageAllocator_H_))
+# define Scuddle_PageAllocator_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+
+# include <new>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for PageAllocator objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief An allocator for standard containers that places large blocks directly in pages.
+     
+     Blocks of at least a huge page are obtained with AllocatePages and are backed by huge pages,
+     where available, which keeps a large population within a few translation lookaside buffer
+     entries; smaller blocks come from the heap.
+     @tparam Element The type of object being allocated. */
+    template <typename Element>
+    class PageAllocator
+    {
+    public :
+        
+        /*! @brief The type of object being allocated. */
+        typedef Element value_type;
+        
+        /*! @brief The constructor. */
+        PageAllocator(void)
+        {
+        } // PageAllocator
+        
+        /*! @brief The converting constructor.
+         @param other The allocator to be copied. */
+        template <typename Other>
+        PageAllocator(const PageAllocator<Other> & other)
+        {
+            static_cast<void>(other);
+        } // PageAllocator
+        
+        /*! @brief Allocate storage for a number of objects.
+         @param count The number of objects.
+         @returns The storage for the objects. */
+        Element *
+        allocate(const size_t count)
+        {
+            void * result;
+            size_t numBytes;
+            
+            if ((std::numeric_limits<size_t>::max() / sizeof(Element)) < count)
+            {
+                throw std::bad_alloc();
+            }
+            numBytes = (count * sizeof(Element));
+            if (kHugePageSize <= numBytes)
+            {
+                result = AllocatePages(numBytes, true);
+                if (! result)
+                {
+                    throw std::bad_alloc();
+                }
+            }
+            else
+            {
+                result = ::operator new(numBytes);
+            }
+            return static_cast<Element *>(result);
+        } // allocate
+        
+        /*! @brief Release storage that was obtained with allocate.
+         @param block The storage to be released.
+         @param count The number of objects passed to allocate. */
+        void
+        deallocate(Element *    block,
+                   const size_t count)
+        {
+            size_t numBytes = (count * sizeof(Element));
+            
+            if (kHugePageSize <= numBytes)
+            {
+                ReleasePages(block, numBytes, true);
+            }
+            else
+            {
+                ::operator delete(block);
+            }
+        } // deallocate
+        
+    protected :
+        
+    private :
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+    }; // PageAllocator
+    
+    /*! @brief Return @c true if storage from one allocator can be released by another.
+     
+     All PageAllocator objects are interchangeable.
+     @param first The first allocator.
+     @param second The second allocator.
+     @returns @c true. */
+    template <typename Element, typename Other>
+    inline bool
+    operator ==(const PageAllocator<Element> & first,
+                const PageAllocator<Other> &   second)
+    {
+        static_cast<void>(first);
+        static_cast<void>(second);
+        return true;
+    } // operator ==
+    
+    /*! @brief Return @c true if storage from one allocator cannot be released by another.
+     
+     All PageAllocator objects are interchangeable.
+     @param first The first allocator.
+     @param second The second allocator.
+     @returns @c false. */
+    template <typename Element, typename Other>
+    inline bool
+    operator !=(const PageAllocator<Element> & first,
+                const PageAllocator<Other> &   second)
+    {
+        return (! (first == second));
+    } // operator !=
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_PageAllocator_H_) */
@@ -0,0 +1,293 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePerformanceCounters.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for reading the hardware performance counters.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddlePerformanceCounters.h"
+
+#if defined(__linux__)
+# include <cstring>
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif // defined(__linux__)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for reading the hardware performance counters. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The names of the counters, for reports. */
+static const char * kCounterNames[] =
+{
+    "cycles",
+    "instructions",
+    "branch-misses",
+    "LLC-misses"
+};
+
+#if defined(__linux__)
+/*! @brief The perf_event configuration of each counter. */
+static const uint64_t kCounterConfigs[] =
+{
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_MISSES
+};
+#endif // defined(__linux__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__linux__)
+/*! @brief Open a hardware counter for the calling thread and the threads that it creates.
+ @param config The perf_event configuration of the counter.
+ @returns The file descriptor of the counter, or @c -1 if it could not be opened. */
+static int
+openCounter(const uint64_t config)
+{
+    struct perf_event_attr attributes;
+    
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = sizeof(attributes);
+    attributes.config = config;
+    attributes.read_format = (PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING);
+    attributes.inherit = 1;
+    // Only user-mode work is counted, so that the counters can be opened without privileges.
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+} // openCounter
+#endif // defined(__linux__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+void
+PerformanceCounters::CalculateChanges(const CounterReadings & start,
+                                      const CounterReadings & finish,
+                                      CounterValues &         changes)
+{
+    for (size_t ii = 0; kNumPerformanceCounters > ii; ++ii)
+    {
+        const CounterReading & startReading = start[ii];
+        const CounterReading & finishReading = finish[ii];
+        
+        // The readings only go down if one of them failed, so that nothing can be said.
+        if ((startReading.value <= finishReading.value) &&
+            (startReading.timeEnabled <= finishReading.timeEnabled) &&
+            (startReading.timeRunning < finishReading.timeRunning))
+        {
+            uint64_t value = (finishReading.value - startReading.value);
+            uint64_t timeEnabled = (finishReading.timeEnabled - startReading.timeEnabled);
+            uint64_t timeRunning = (finishReading.timeRunning - startReading.timeRunning);
+            
+            if (timeEnabled == timeRunning)
+            {
+                changes[ii] = value;
+            }
+            else
+            {
+                // The counter was only running for part of the time, so estimate the full count.
+                changes[ii] = static_cast<uint64_t>(static_cast<double>(value) * timeEnabled /
+                                                    timeRunning);
+            }
+        }
+        else
+        {
+            changes[ii] = 0;
+        }
+    }
+} // PerformanceCounters::CalculateChanges
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PerformanceCounters::PerformanceCounters(void)
+{
+    for (size_t ii = 0; kNumPerformanceCounters > ii; ++ii)
+    {
+#if defined(__linux__)
+        _descriptors[ii] = openCounter(kCounterConfigs[ii]);
+#else // ! defined(__linux__)
+        _descriptors[ii] = -1;
+#endif // ! defined(__linux__)
+    }
+} // PerformanceCounters::PerformanceCounters
+
+PerformanceCounters::~PerformanceCounters(void)
+{
+#if defined(__linux__)
+    for (size_t ii = 0; kNumPerformanceCounters > ii; ++ii)
+    {
+        if (0 <= _descriptors[ii])
+        {
+            close(_descriptors[ii]);
+        }
+    }
+#endif // defined(__linux__)
+} // PerformanceCounters::~PerformanceCounters
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+PerformanceCounters::isAvailable(void)
+const
+{
+    bool result = false;
+    
+    for (size_t ii = 0; (! result) && (kNumPerformanceCounters > ii); ++ii)
+    {
+        result = (0 <= _descriptors[ii]);
+    }
+    return result;
+} // PerformanceCounters::isAvailable
+
+void
+PerformanceCounters::read(CounterReadings & readings)
+const
+{
+    for (size_t ii = 0; kNumPerformanceCounters > ii; ++ii)
+    {
+        CounterReading & aReading = readings[ii];
+        
+        aReading.value = 0;
+        aReading.timeEnabled = 0;
+        aReading.timeRunning = 0;
+#if defined(__linux__)
+        if (0 <= _descriptors[ii])
+        {
+            uint64_t buffer[3]; // value, time enabled, time running
+            
+            if (sizeof(buffer) == ::read(_descriptors[ii], buffer, sizeof(buffer)))
+            {
+                aReading.value = buffer[0];
+                aReading.timeEnabled = buffer[1];
+                aReading.timeRunning = buffer[2];
+            }
+        }
+#endif // defined(__linux__)
+    }
+} // PerformanceCounters::read
+
+void
+PerformanceCounters::report(std::ostream &              outStream,
+                            const CounterSampleVector & samples)
+const
+{
+    if (isAvailable())
+    {
+        for (CounterSampleVector::const_iterator walker(samples.begin());
+             samples.end() != walker; ++walker)
+        {
+            if (walker->finalSelection)
+            {
+                outStream << "Final selection:" << std::endl;
+            }
+            else
+            {
+                outStream << "Generation " << (walker->generation + 1) << ":" << std::endl;
+            }
+            for (size_t ii = 0; kNumEnginePhases > ii; ++ii)
+            {
+                const CounterValues & values = walker->phases[ii];
+                EnginePhase           phase = static_cast<EnginePhase>(ii);
+                
+                if (IsPhaseInSample(phase, walker->finalSelection, walker->statistics))
+                {
+                    outStream << "  " << GetEnginePhaseName(phase) << ":";
+                    for (size_t jj = 0; kNumPerformanceCounters > jj; ++jj)
+                    {
+                        outStream << " " << kCounterNames[jj] << " ";
+                        if (isAvailable(static_cast<PerformanceCounter>(jj)))
+                        {
+                            outStream << values[jj];
+                        }
+                        else
+                        {
+                            outStream << "n/a";
+                        }
+                    }
+                    if (isAvailable(kCounterCycles) && isAvailable(kCounterInstructions) &&
+                        (0 < values[kCounterCycles]))
+                    {
+                        outStream << " IPC " <<
+                                    (static_cast<double>(values[kCounterInstructions]) /
+                                     values[kCounterCycles]);
+                    }
+                    outStream << std::endl;
+                }
+            }
+        }
+    }
+    else
+    {
+        outStream << "Performance counters are not available." << std::endl;
+    }
+} // PerformanceCounters::report
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,216 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePerformanceCounters.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for reading the hardware performance counters.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_PerformanceCounters_H_))
+# define Scuddle_PerformanceCounters_H_ /* Header guard */
+
+# include "ScuddlePhaseStatistics.h"
+
+# include <array>
+# include <cstdint>
+# include <ostream>
+# include <vector>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for reading the hardware performance counters. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief The hardware performance counters that are read. */
+    enum PerformanceCounter
+    {
+        /*! @brief CPU cycles. */
+        kCounterCycles,
+        
+        /*! @brief Instructions retired. */
+        kCounterInstructions,
+        
+        /*! @brief Mispredicted branches. */
+        kCounterBranchMisses,
+        
+        /*! @brief Last-level cache misses. */
+        kCounterCacheMisses
+        
+    }; // PerformanceCounter
+    
+    /*! @brief The number of hardware performance counters that are read. */
+    const size_t kNumPerformanceCounters = (kCounterCacheMisses + 1);
+    
+    /*! @brief The values of the hardware performance counters. */
+    typedef std::array<uint64_t, kNumPerformanceCounters> CounterValues;
+    
+    /*! @brief A reading of a hardware performance counter, as it was returned by the kernel. */
+    struct CounterReading
+    {
+        /*! @brief The number of events counted while the counter was running. */
+        uint64_t value;
+        
+        /*! @brief The time for which the counter was enabled, in nanoseconds. */
+        uint64_t timeEnabled;
+        
+        /*! @brief The time for which the counter was running, in nanoseconds. */
+        uint64_t timeRunning;
+        
+    }; // CounterReading
+    
+    /*! @brief The readings of the hardware performance counters. */
+    typedef std::array<CounterReading, kNumPerformanceCounters> CounterReadings;
+    
+    /*! @brief The changes in the hardware performance counters over each phase of a generation. */
+    struct CounterSample
+    {
+        /*! @brief The number of generations that had been produced when the sample was taken. */
+        size_t generation;
+        
+        /*! @brief @c true if the sample covers the final selections rather than a generation. */
+        bool finalSelection;
+        
+        /*! @brief @c true if the population was summarized during the generation. */
+        bool statistics;
+        
+        /*! @brief The changes in the counters over each phase; the generation phase holds the
+         total over the other phases. */
+        std::array<CounterValues, kNumEnginePhases> phases;
+        
+    }; // CounterSample
+    
+    /*! @brief A sequence of samples of the hardware performance counters. */
+    typedef std::vector<CounterSample> CounterSampleVector;
+    
+    /*! @brief The hardware performance counters of the calling thread and of the threads that it
+     creates afterwards.
+     
+     The counters are only available on Linux, through perf_event_open, and only count user-mode
+     work. Any counter that cannot be opened - for example, in a container without access to the
+     performance monitoring unit - reads as zero and is reported as unavailable. */
+    class PerformanceCounters
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The counters are opened and started. */
+        PerformanceCounters(void);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~PerformanceCounters(void);
+        
+        /*! @brief Calculate the changes in the counters between two readings.
+         
+         The changes are scaled up if the kernel had to share the hardware between counters
+         while they were being made. A counter that could not be read at either end, and so
+         appears to have gone backwards, has no change.
+         @param start The readings at the start of the interval.
+         @param finish The readings at the end of the interval.
+         @param changes Set to the changes in the counters over the interval. */
+        static void
+        CalculateChanges(const CounterReadings & start,
+                         const CounterReadings & finish,
+                         CounterValues &         changes);
+        
+        /*! @brief Return @c true if any of the counters could be opened.
+         @returns @c true if any of the counters could be opened. */
+        bool
+        isAvailable(void)
+        const;
+        
+        /*! @brief Return @c true if a counter could be opened.
+         @param counter The counter of interest.
+         @returns @c true if the counter could be opened. */
+        bool
+        isAvailable(const PerformanceCounter counter)
+        const
+        {
+            return (0 <= _descriptors[counter]);
+        } // isAvailable
+        
+        /*! @brief Read the counters.
+         
+         The readings are not scaled, so that the changes between two readings can be scaled by
+         the time that the counters were running between them.
+         @param readings Set to the current readings of the counters; a counter that could not
+         be opened or read reads as zero. */
+        void
+        read(CounterReadings & readings)
+        const;
+        
+        /*! @brief Print out the changes in the counters for each sample.
+         @param outStream The stream to write to.
+         @param samples The samples to be printed. */
+        void
+        report(std::ostream &              outStream,
+               const CounterSampleVector & samples)
+        const;
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        PerformanceCounters(const PerformanceCounters & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        PerformanceCounters &
+        operator =(const PerformanceCounters & other);
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The file descriptors of the counters; @c -1 if a counter could not be opened. */
+        std::array<int, kNumPerformanceCounters> _descriptors;
+        
+    }; // PerformanceCounters
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_PerformanceCounters_H_) */
@@ -0,0 +1,267 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePhaseStatistics.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for the timing of the phases of the evolution engines.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddlePhaseStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the timing of the phases of the evolution engines. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The names of the phases, for reports. */
+static const char * kPhaseNames[] =
+{
+    "Fitness",
+    "Statistics",
+    "Selection",
+    "Crossover",
+    "Mutation",
+    "Final selection",
+    "Generation"
+};
+
+static_assert((sizeof(kPhaseNames) / sizeof(*kPhaseNames)) == kNumEnginePhases,
+              "There must be a name for each phase");
+
+/*! @brief The number of nanoseconds in a second. */
+static const double kNanosecondsPerSecond = 1e9;
+
+/*! @brief The number of nanoseconds in a millisecond. */
+static const double kNanosecondsPerMillisecond = 1e6;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the histogram bucket for a duration.
+ @param nanoseconds The duration, in nanoseconds.
+ @returns The index of the power-of-two bucket that holds the duration. */
+static size_t
+bucketForDuration(const uint64_t nanoseconds)
+{
+    size_t result;
+    
+#if defined(__GNUC__)
+    result = static_cast<size_t>(63 - __builtin_clzll(nanoseconds | 1));
+#else // ! defined(__GNUC__)
+    result = 0;
+    for (uint64_t remainder = (nanoseconds >> 1); 0 != remainder; remainder >>= 1)
+    {
+        ++result;
+    }
+#endif // ! defined(__GNUC__)
+    return std::min(result, kNumLatencyBuckets - 1);
+} // bucketForDuration
+
+/*! @brief Return the rate at which work was done.
+ @param amount The amount of work done.
+ @param nanoseconds The time taken to do the work, in nanoseconds.
+ @returns The amount of work done per second, or @c 0 if no time was taken. */
+static double
+rateOfWork(const uint64_t amount,
+           const uint64_t nanoseconds)
+{
+    return ((0 < nanoseconds) ? ((amount * kNanosecondsPerSecond) / nanoseconds) : 0);
+} // rateOfWork
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PhaseStatistics::PhaseStatistics(void)
+{
+    reset();
+} // PhaseStatistics::PhaseStatistics
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+double
+PhaseStatistics::getEvaluationRate(void)
+const
+{
+    return rateOfWork(_numEvaluations, _phases[kPhaseFitness]._total);
+} // PhaseStatistics::getEvaluationRate
+
+double
+PhaseStatistics::getIndividualRate(void)
+const
+{
+    return rateOfWork(_numIndividuals, _phases[kPhaseGeneration]._total);
+} // PhaseStatistics::getIndividualRate
+
+double
+PhaseStatistics::getMean(const EnginePhase phase)
+const
+{
+    const PhaseRecord & aRecord = _phases[phase];
+    
+    return (aRecord._count ? (static_cast<double>(aRecord._total) / aRecord._count) : 0);
+} // PhaseStatistics::getMean
+
+uint64_t
+PhaseStatistics::getPercentile(const EnginePhase phase,
+                               const double      fraction)
+const
+{
+    const PhaseRecord & aRecord = _phases[phase];
+    uint64_t            result = 0;
+    
+    if (aRecord._count)
+    {
+        // The nearest-rank method; the rank is counted from zero.
+        uint64_t rank = static_cast<uint64_t>(std::ceil(std::max(0.0, std::min(1.0, fraction)) *
+                                                        aRecord._count));
+        uint64_t seen = 0;
+        
+        rank = ((0 < rank) ? (rank - 1) : 0);
+        
+        result = aRecord._maximum;
+        for (size_t ii = 0; kNumLatencyBuckets > ii; ++ii)
+        {
+            seen += aRecord._buckets[ii];
+            if (rank < seen)
+            {
+                if ((kNumLatencyBuckets - 1) > ii)
+                {
+                    result = std::min(result, (static_cast<uint64_t>(2) << ii) - 1);
+                }
+                break;
+            }
+        }
+    }
+    return result;
+} // PhaseStatistics::getPercentile
+
+void
+PhaseStatistics::record(const EnginePhase       phase,
+                        const Clock::duration & duration)
+{
+    PhaseRecord & aRecord = _phases[phase];
+    uint64_t      nanoseconds = static_cast<uint64_t>(std::max(static_cast<int64_t>(0),
+                                static_cast<int64_t>(std::chrono::duration_cast<
+                                                     std::chrono::nanoseconds>(duration).count())));
+    
+    ++aRecord._count;
+    aRecord._total += nanoseconds;
+    aRecord._minimum = std::min(aRecord._minimum, nanoseconds);
+    aRecord._maximum = std::max(aRecord._maximum, nanoseconds);
+    ++aRecord._buckets[bucketForDuration(nanoseconds)];
+} // PhaseStatistics::record
+
+void
+PhaseStatistics::report(std::ostream & outStream)
+const
+{
+    for (size_t ii = 0; kNumEnginePhases > ii; ++ii)
+    {
+        EnginePhase phase = static_cast<EnginePhase>(ii);
+        
+        if (_phases[ii]._count)
+        {
+            outStream << GetEnginePhaseName(phase) << " time: " <<
+                        (_phases[ii]._total / kNanosecondsPerMillisecond) << " (mean " <<
+                        (getMean(phase) / kNanosecondsPerMillisecond) << ", p50 " <<
+                        (getPercentile(phase, 0.5) / kNanosecondsPerMillisecond) << ", p99 " <<
+                        (getPercentile(phase, 0.99) / kNanosecondsPerMillisecond) << ", max " <<
+                        (_phases[ii]._maximum / kNanosecondsPerMillisecond) << ") msec over " <<
+                        _phases[ii]._count << std::endl;
+        }
+    }
+    outStream << "Evaluations: " << _numEvaluations << " (" << getEvaluationRate() << "/sec)" <<
+                std::endl;
+    outStream << "Individuals: " << _numIndividuals << " (" << getIndividualRate() << "/sec)" <<
+                std::endl;
+} // PhaseStatistics::report
+
+void
+PhaseStatistics::reset(void)
+{
+    for (size_t ii = 0; kNumEnginePhases > ii; ++ii)
+    {
+        PhaseRecord & aRecord = _phases[ii];
+        
+        aRecord._count = 0;
+        aRecord._total = 0;
+        aRecord._minimum = std::numeric_limits<uint64_t>::max();
+        aRecord._maximum = 0;
+        aRecord._buckets.fill(0);
+    }
+    _numEvaluations = 0;
+    _numIndividuals = 0;
+} // PhaseStatistics::reset
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+const char *
+Scuddle::GetEnginePhaseName(const EnginePhase phase)
+{
+    return kPhaseNames[phase];
+} // Scuddle::GetEnginePhaseName
@@ -0,0 +1,322 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePhaseStatistics.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for the timing of the phases of the evolution engines.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_PhaseStatistics_H_))
+# define Scuddle_PhaseStatistics_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+
+# include <array>
+# include <chrono>
+# include <cstdint>
+# include <ostream>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the timing of the phases of the evolution engines. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief The phases of an evolution engine that are timed. */
+    enum EnginePhase
+    {
+        /*! @brief Calculating or rescoring the fitness values. */
+        kPhaseFitness,
+        
+        /*! @brief Summarizing the population. */
+        kPhaseStatistics,
+        
+        /*! @brief Selecting the parents of a generation. */
+        kPhaseSelection,
+        
+        /*! @brief Producing the children of a generation. */
+        kPhaseCrossover,
+        
+        /*! @brief Mutating some of the objects of a generation. */
+        kPhaseMutation,
+        
+        /*! @brief Making the final selections. */
+        kPhaseFinalSelection,
+        
+        /*! @brief Producing a whole generation. */
+        kPhaseGeneration
+        
+    }; // EnginePhase
+    
+    /*! @brief The number of phases that are timed. */
+    const size_t kNumEnginePhases = (kPhaseGeneration + 1);
+    
+    /*! @brief Return the name of a phase, for reports.
+     @param phase The phase of interest.
+     @returns The name of the phase. */
+    const char *
+    GetEnginePhaseName(const EnginePhase phase);
+    
+    /*! @brief Return @c true if a phase is recorded in the sample of a generation or of a final
+     selection.
+     
+     The final selections only have a fitness phase and a final selection phase, and the
+     generations only have a statistics phase if the population was summarized.
+     @param phase The phase of interest.
+     @param finalSelection @c true if the sample is of a final selection.
+     @param statistics @c true if the population was summarized in the generation.
+     @returns @c true if the phase is recorded in the sample. */
+    inline bool
+    IsPhaseInSample(const EnginePhase phase,
+                    const bool        finalSelection,
+                    const bool        statistics)
+    {
+        bool result;
+        
+        if (finalSelection)
+        {
+            result = ((kPhaseFitness == phase) || (kPhaseFinalSelection == phase) ||
+                      (kPhaseGeneration == phase));
+        }
+        else
+        {
+            result = ((kPhaseFinalSelection != phase) &&
+                      ((kPhaseStatistics != phase) || statistics));
+        }
+        return result;
+    } // IsPhaseInSample
+    
+    /*! @brief The number of buckets in each latency histogram.
+     
+     Bucket @c n counts the durations of at least 2^n and less than 2^(n+1) nanoseconds; the last
+     bucket also counts all longer durations. */
+    const size_t kNumLatencyBuckets = 40;
+    
+    /*! @brief The accumulated durations of the phases of an evolution engine, along with the
+     amount of work done.
+     
+     Each phase keeps its count, total, extremes and a histogram of durations with power-of-two
+     buckets, so that recording a duration takes a constant, small amount of time. */
+    class PhaseStatistics
+    {
+    public :
+        
+        /*! @brief The clock used to time the phases. */
+        typedef std::chrono::steady_clock Clock;
+        
+        /*! @brief The constructor. */
+        PhaseStatistics(void);
+        
+        /*! @brief The copy constructor.
+         @param other The object to be copied. */
+        PhaseStatistics(const PhaseStatistics & other) = default;
+        
+        /*! @brief The destructor. */
+        ~PhaseStatistics(void) = default;
+        
+        /*! @brief Record the number of objects whose fitness was evaluated.
+         @param numEvaluations The number of objects whose fitness was evaluated. */
+        void
+        addEvaluations(const uint64_t numEvaluations)
+        {
+            _numEvaluations += numEvaluations;
+        } // addEvaluations
+        
+        /*! @brief Record the number of objects that passed through a generation.
+         @param numIndividuals The number of objects that passed through a generation. */
+        void
+        addIndividuals(const uint64_t numIndividuals)
+        {
+            _numIndividuals += numIndividuals;
+        } // addIndividuals
+        
+        /*! @brief Return the number of durations of a phase that fell in a histogram bucket.
+         @param phase The phase of interest.
+         @param bucket The index of the bucket.
+         @returns The number of durations of the phase that fell in the bucket. */
+        uint64_t
+        getBucketCount(const EnginePhase phase,
+                       const size_t      bucket)
+        const
+        {
+            return _phases[phase]._buckets[bucket];
+        } // getBucketCount
+        
+        /*! @brief Return the number of durations recorded for a phase.
+         @param phase The phase of interest.
+         @returns The number of durations recorded for the phase. */
+        uint64_t
+        getCount(const EnginePhase phase)
+        const
+        {
+            return _phases[phase]._count;
+        } // getCount
+        
+        /*! @brief Return the number of fitness evaluations per second spent in the fitness phase.
+         @returns The number of fitness evaluations per second, or @c 0 if no time was recorded. */
+        double
+        getEvaluationRate(void)
+        const;
+        
+        /*! @brief Return the number of objects that passed through a generation per second spent
+         producing generations.
+         @returns The number of objects per second, or @c 0 if no time was recorded. */
+        double
+        getIndividualRate(void)
+        const;
+        
+        /*! @brief Return the longest duration recorded for a phase.
+         @param phase The phase of interest.
+         @returns The longest duration recorded for the phase, in nanoseconds. */
+        uint64_t
+        getMaximum(const EnginePhase phase)
+        const
+        {
+            return _phases[phase]._maximum;
+        } // getMaximum
+        
+        /*! @brief Return the mean duration recorded for a phase.
+         @param phase The phase of interest.
+         @returns The mean duration recorded for the phase, in nanoseconds. */
+        double
+        getMean(const EnginePhase phase)
+        const;
+        
+        /*! @brief Return the shortest duration recorded for a phase.
+         @param phase The phase of interest.
+         @returns The shortest duration recorded for the phase, in nanoseconds, or @c 0 if none
+         was recorded. */
+        uint64_t
+        getMinimum(const EnginePhase phase)
+        const
+        {
+            return (_phases[phase]._count ? _phases[phase]._minimum : 0);
+        } // getMinimum
+        
+        /*! @brief Return an estimate of a percentile of the durations of a phase.
+         
+         The estimate is the upper bound of the histogram bucket that holds the percentile,
+         limited to the longest duration recorded.
+         @param phase The phase of interest.
+         @param fraction The percentile, as a fraction between 0 and 1.
+         @returns The estimated percentile, in nanoseconds. */
+        uint64_t
+        getPercentile(const EnginePhase phase,
+                      const double      fraction)
+        const;
+        
+        /*! @brief Return the total duration recorded for a phase.
+         @param phase The phase of interest.
+         @returns The total duration recorded for the phase, in nanoseconds. */
+        uint64_t
+        getTotal(const EnginePhase phase)
+        const
+        {
+            return _phases[phase]._total;
+        } // getTotal
+        
+        /*! @brief The assignment operator.
+         @param other The object to be copied.
+         @returns The updated object. */
+        PhaseStatistics &
+        operator =(const PhaseStatistics & other) = default;
+        
+        /*! @brief Record a duration of a phase.
+         @param phase The phase that was timed.
+         @param duration The duration of the phase. */
+        void
+        record(const EnginePhase       phase,
+               const Clock::duration & duration);
+        
+        /*! @brief Print out the durations of each phase and the rates of work.
+         @param outStream The stream to write to. */
+        void
+        report(std::ostream & outStream)
+        const;
+        
+        /*! @brief Discard all the recorded durations and amounts of work. */
+        void
+        reset(void);
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The durations recorded for a phase. */
+        struct PhaseRecord
+        {
+            /*! @brief The number of durations. */
+            uint64_t _count;
+            
+            /*! @brief The sum of the durations, in nanoseconds. */
+            uint64_t _total;
+            
+            /*! @brief The shortest duration, in nanoseconds. */
+            uint64_t _minimum;
+            
+            /*! @brief The longest duration, in nanoseconds. */
+            uint64_t _maximum;
+            
+            /*! @brief The number of durations in each power-of-two range. */
+            std::array<uint64_t, kNumLatencyBuckets> _buckets;
+            
+        }; // PhaseRecord
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The durations recorded for each phase. */
+        std::array<PhaseRecord, kNumEnginePhases> _phases;
+        
+        /*! @brief The number of objects whose fitness was evaluated. */
+        uint64_t _numEvaluations;
+        
+        /*! @brief The number of objects that passed through a generation. */
+        uint64_t _numIndividuals;
+        
+    }; // PhaseStatistics
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_PhaseStatistics_H_) */
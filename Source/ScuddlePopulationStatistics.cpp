@@ -0,0 +1,275 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePopulationStatistics.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for PopulationStatistics objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddlePopulationStatistics.h"
+
+#include <limits>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for PopulationStatistics objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The names of the Bartenieff configurations, for reports. */
+static const char * kBartenieffNames[] =
+{
+    "none",
+    "distal",
+    "medial",
+    "homologous",
+    "homolateral",
+    "contralateral"
+};
+
+/*! @brief The names of the levels of Effort, for reports. */
+static const char * kEffortNames[] =
+{
+    "low",
+    "medium",
+    "high"
+};
+
+/*! @brief The names of the leg configurations, for reports. */
+static const char * kHeightNames[] =
+{
+    "none",
+    "unextended",
+    "lower-extended",
+    "fully-extended"
+};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Print out the number of objects in each class.
+ @param outStream The stream to write to.
+ @param label The name of the kind of class.
+ @param names The names of the classes.
+ @param counts The number of objects in each class.
+ @param numClasses The number of classes. */
+static void
+reportCounts(std::ostream &   outStream,
+             const char *     label,
+             const char * *   names,
+             const uint64_t * counts,
+             const size_t     numClasses)
+{
+    outStream << "  " << label << ":";
+    for (size_t ii = 0; numClasses > ii; ++ii)
+    {
+        outStream << " " << names[ii] << " " << counts[ii];
+    }
+    outStream << std::endl;
+} // reportCounts
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PopulationStatistics::PopulationStatistics(void)
+{
+    reset();
+} // PopulationStatistics::PopulationStatistics
+
+PopulationStatistics::~PopulationStatistics(void)
+{
+} // PopulationStatistics::~PopulationStatistics
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+PopulationStatistics::addAngles(const size_t     angleIndex,
+                                const realType * angles,
+                                const size_t     numAngles)
+{
+    SectorCounts & sectors = _angleSectors[angleIndex];
+    realType       turnsPerRadian = SectorTurnsPerRadian(angleIndex);
+    
+    for (size_t ii = 0; numAngles > ii; ++ii)
+    {
+        ++sectors[SectorForAngle(angles[ii], turnsPerRadian)];
+    }
+} // PopulationStatistics::addAngles
+
+void
+PopulationStatistics::addScores(const realType * scores,
+                                const size_t     numScores)
+{
+    double sum = 0;
+    double minimum = _minimum;
+    double maximum = _maximum;
+    
+    // The moments are kept apart from the sketch, so that this loop can be vectorized.
+    for (size_t ii = 0; numScores > ii; ++ii)
+    {
+        double score = scores[ii];
+        
+        sum += score;
+        minimum = std::min(minimum, score);
+        maximum = std::max(maximum, score);
+    }
+    _sum += sum;
+    _minimum = minimum;
+    _maximum = maximum;
+    _count += numScores;
+    for (size_t ii = 0; numScores > ii; ++ii)
+    {
+        _sketch.add(scores[ii]);
+    }
+} // PopulationStatistics::addScores
+
+void
+PopulationStatistics::finish(const size_t           generation,
+                             GenerationStatistics & result)
+{
+    double diversity = 0;
+    size_t numAngles = 0;
+    
+    _sketch.compress();
+    result.generation = generation;
+    result.count = _count;
+    result.minimumFitness = (_count ? _minimum : 0);
+    result.meanFitness = (_count ? (_sum / _count) : 0);
+    result.maximumFitness = (_count ? _maximum : 0);
+    for (size_t ii = 0; kNumFitnessQuantiles > ii; ++ii)
+    {
+        result.fitnessQuantiles[ii] = _sketch.getQuantile(kFitnessQuantileFractions[ii]);
+    }
+    result.bartenieffCounts = _bartenieffCounts;
+    result.effortCounts = _effortCounts;
+    result.heightCounts = _heightCounts;
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        const SectorCounts & sectors = _angleSectors[ii];
+        uint64_t             total = 0;
+        
+        for (size_t jj = 0; kNumAngleSectors > jj; ++jj)
+        {
+            total += sectors[jj];
+        }
+        if (total)
+        {
+            double entropy = 0;
+            
+            for (size_t jj = 0; kNumAngleSectors > jj; ++jj)
+            {
+                if (sectors[jj])
+                {
+                    double fraction = (static_cast<double>(sectors[jj]) / total);
+                    
+                    entropy -= (fraction * std::log(fraction));
+                }
+            }
+            diversity += (entropy / std::log(static_cast<double>(kNumAngleSectors)));
+            ++numAngles;
+        }
+    }
+    result.angleDiversity = (numAngles ? (diversity / numAngles) : 0);
+} // PopulationStatistics::finish
+
+void
+PopulationStatistics::reset(void)
+{
+    _sketch.reset();
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        _angleSectors[ii].fill(0);
+    }
+    _bartenieffCounts.fill(0);
+    _effortCounts.fill(0);
+    _heightCounts.fill(0);
+    _maximum = -std::numeric_limits<double>::infinity();
+    _minimum = std::numeric_limits<double>::infinity();
+    _sum = 0;
+    _count = 0;
+} // PopulationStatistics::reset
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+void
+Scuddle::ReportGenerationStatistics(std::ostream &               outStream,
+                                    const GenerationStatistics & statistics)
+{
+    outStream << "Generation " << (statistics.generation + 1) << ": " << statistics.count <<
+                " objects, fitness min " << statistics.minimumFitness << " mean " <<
+                statistics.meanFitness << " max " << statistics.maximumFitness << std::endl;
+    outStream << "  fitness quantiles:";
+    for (size_t ii = 0; kNumFitnessQuantiles > ii; ++ii)
+    {
+        outStream << " p" << (kFitnessQuantileFractions[ii] * 100) << " " <<
+                    statistics.fitnessQuantiles[ii];
+    }
+    outStream << std::endl;
+    reportCounts(outStream, "Bartenieff", kBartenieffNames, statistics.bartenieffCounts.data(),
+                 kNumBartenieffClasses);
+    reportCounts(outStream, "Effort", kEffortNames, statistics.effortCounts.data(),
+                 kNumEffortClasses);
+    reportCounts(outStream, "Height", kHeightNames, statistics.heightCounts.data(),
+                 kNumHeightClasses);
+    outStream << "  angle diversity: " << statistics.angleDiversity << std::endl;
+} // Scuddle::ReportGenerationStatistics
@@ -0,0 +1,303 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePopulationStatistics.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for PopulationStatistics objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_PopulationStatistics_H_))
+# define Scuddle_PopulationStatistics_H_ /* Header guard */
+
+# include "ScuddleQuantileSketch.h"
+# include "ScuddleSkeleton.h"
+
+# include <algorithm>
+# include <array>
+# include <cmath>
+# include <cstdint>
+# include <functional>
+# include <ostream>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for PopulationStatistics objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief The number of quantiles of the fitness values that are reported. */
+    const size_t kNumFitnessQuantiles = 5;
+    
+    /*! @brief The quantiles of the fitness values that are reported. */
+    const double kFitnessQuantileFractions[kNumFitnessQuantiles] =
+    {
+        0.01, 0.1, 0.5, 0.9, 0.99
+    };
+    
+    /*! @brief The number of equal sectors of its range that each angle is counted in, to measure
+     the spread of the angles. */
+    const size_t kNumAngleSectors = 16;
+    
+    /*! @brief The number of turns of the circle in one radian. */
+    const realType kTurnsPerRadian = static_cast<realType>(0.15915494309189533577);
+    
+    /*! @brief A summary of the objects of a population. */
+    struct GenerationStatistics
+    {
+        /*! @brief The number of generations that had been produced when the population was
+         summarized. */
+        size_t generation;
+        
+        /*! @brief The number of objects. */
+        uint64_t count;
+        
+        /*! @brief The smallest fitness value. */
+        double minimumFitness;
+        
+        /*! @brief The mean fitness value. */
+        double meanFitness;
+        
+        /*! @brief The largest fitness value. */
+        double maximumFitness;
+        
+        /*! @brief The estimated fitness values at each of kFitnessQuantileFractions. */
+        std::array<double, kNumFitnessQuantiles> fitnessQuantiles;
+        
+        /*! @brief The number of objects in each BartenieffClass. */
+        std::array<uint64_t, kNumBartenieffClasses> bartenieffCounts;
+        
+        /*! @brief The number of objects in each EffortClass. */
+        std::array<uint64_t, kNumEffortClasses> effortCounts;
+        
+        /*! @brief The number of objects in each HeightClass. */
+        std::array<uint64_t, kNumHeightClasses> heightCounts;
+        
+        /*! @brief The spread of the angles, from @c 0 when every object has the same angles to
+         @c 1 when each angle is spread evenly over its range.
+         
+         This is the entropy of the sectors occupied by each angle, relative to the largest
+         possible entropy, averaged over the angles. */
+        double angleDiversity;
+        
+    }; // GenerationStatistics
+    
+    /*! @brief A function that is given the summary of each generation. */
+    typedef std::function<void(const GenerationStatistics &)> StatisticsCallback;
+    
+    /*! @brief The gatherer of a summary of the objects of a population.
+     
+     The summary is gathered in one pass over the objects and its storage is fixed when the
+     gatherer is constructed, whatever the size of the population, so that a population of
+     millions of objects can be watched every generation. */
+    class PopulationStatistics
+    {
+    public :
+        
+        /*! @brief The constructor. */
+        PopulationStatistics(void);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~PopulationStatistics(void);
+        
+        /*! @brief Add an angle of an object.
+         @param angleIndex The index of the angle, from Skeleton::AngleIndices.
+         @param angle The angle, in radians. */
+        void
+        addAngle(const size_t   angleIndex,
+                 const realType angle)
+        {
+            ++_angleSectors[angleIndex][SectorForAngle(angle, SectorTurnsPerRadian(angleIndex))];
+        } // addAngle
+        
+        /*! @brief Add an angle of each of a set of objects.
+         @param angleIndex The index of the angles, from Skeleton::AngleIndices.
+         @param angles The angles, in radians.
+         @param numAngles The number of angles. */
+        void
+        addAngles(const size_t     angleIndex,
+                  const realType * angles,
+                  const size_t     numAngles);
+        
+        /*! @brief Add the classification of an object.
+         @param factors The fitness factors of the object. */
+        void
+        addFactors(const FitnessFactors & factors)
+        {
+            ++_bartenieffCounts[factors.bartenieffClass];
+            ++_effortCounts[factors.effortClass];
+            ++_heightCounts[factors.heightClass];
+        } // addFactors
+        
+        /*! @brief Add the fitness value of an object.
+         @param score The fitness value of the object. */
+        void
+        addScore(const realType score)
+        {
+            _sum += score;
+            _minimum = std::min(_minimum, static_cast<double>(score));
+            _maximum = std::max(_maximum, static_cast<double>(score));
+            ++_count;
+            _sketch.add(score);
+        } // addScore
+        
+        /*! @brief Add the fitness values of a set of objects.
+         @param scores The fitness values of the objects.
+         @param numScores The number of fitness values. */
+        void
+        addScores(const realType * scores,
+                  const size_t     numScores);
+        
+        /*! @brief Complete the summary of the objects that have been added.
+         @param generation The number of generations that had been produced.
+         @param result Set to the summary of the objects. */
+        void
+        finish(const size_t           generation,
+               GenerationStatistics & result);
+        
+        /*! @brief Discard the objects that have been added, to start a new summary. */
+        void
+        reset(void);
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        PopulationStatistics(const PopulationStatistics & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        PopulationStatistics &
+        operator =(const PopulationStatistics & other);
+        
+        /*! @brief The number of angles in each sector of their range. */
+        typedef std::array<uint64_t, kNumAngleSectors> SectorCounts;
+        
+        /*! @brief Return the sector of its range that contains an angle.
+         @param angle The angle, in radians.
+         @param turnsPerRadian The fraction of the range of the angle in one radian.
+         @returns The index of the sector that contains the angle. */
+        static size_t
+        SectorForAngle(const realType angle,
+                       const realType turnsPerRadian)
+        {
+            realType turns = (angle * turnsPerRadian);
+            
+            // The fraction of the range, so that angles outside of the range are wrapped around.
+            turns -= std::floor(turns);
+            return std::min(static_cast<size_t>(turns * kNumAngleSectors), kNumAngleSectors - 1);
+        } // SectorForAngle
+        
+        /*! @brief Return the fraction of the range of an angle in one radian.
+         
+         The elbow-to-wrist and knee-to-foot angles only cover half of the circle, so their
+         range is spread over all of the sectors, as for the other angles.
+         @param angleIndex The index of the angle, from Skeleton::AngleIndices.
+         @returns The fraction of the range of the angle in one radian. */
+        static realType
+        SectorTurnsPerRadian(const size_t angleIndex)
+        {
+            realType result;
+            
+            switch (angleIndex)
+            {
+                case Skeleton::kLeftElbowToWrist :
+                case Skeleton::kRightElbowToWrist :
+                case Skeleton::kLeftKneeToFoot :
+                case Skeleton::kRightKneeToFoot :
+                    result = (2 * kTurnsPerRadian);
+                    break;
+                    
+                default :
+                    result = kTurnsPerRadian;
+                    break;
+                    
+            }
+            return result;
+        } // SectorTurnsPerRadian
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The estimator of the quantiles of the fitness values. */
+        QuantileSketch _sketch;
+        
+        /*! @brief The number of objects with each angle in each sector of its range. */
+        std::array<SectorCounts, Skeleton::kNumCalculatedAngles> _angleSectors;
+        
+        /*! @brief The number of objects in each BartenieffClass. */
+        std::array<uint64_t, kNumBartenieffClasses> _bartenieffCounts;
+        
+        /*! @brief The number of objects in each EffortClass. */
+        std::array<uint64_t, kNumEffortClasses> _effortCounts;
+        
+        /*! @brief The number of objects in each HeightClass. */
+        std::array<uint64_t, kNumHeightClasses> _heightCounts;
+        
+        /*! @brief The largest fitness value. */
+        double _maximum;
+        
+        /*! @brief The smallest fitness value. */
+        double _minimum;
+        
+        /*! @brief The sum of the fitness values. */
+        double _sum;
+        
+        /*! @brief The number of fitness values. */
+        uint64_t _count;
+        
+    }; // PopulationStatistics
+    
+    /*! @brief Print out the summary of a generation.
+     @param outStream The stream to write to.
+     @param statistics The summary to be printed. */
+    void
+    ReportGenerationStatistics(std::ostream &               outStream,
+                               const GenerationStatistics & statistics);
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_PopulationStatistics_H_) */
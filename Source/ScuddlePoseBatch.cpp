@@ -0,0 +1,1180 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePoseBatch.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for PoseBatch objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddlePoseBatch.h"
+
+#include "ScuddleFitnessTables.h"
+
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+# define VECTOR_FITNESS_ /* Build the SSE and AVX2 fitness kernels. */
+#endif // defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#if defined(VECTOR_FITNESS_)
+# include <immintrin.h>
+#endif // defined(VECTOR_FITNESS_)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for PoseBatch objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The columns and coefficients used by the fitness kernels. */
+struct FitnessColumns
+{
+    /*! @brief The columns of angles (in radians). */
+    const realType * angles[Skeleton::kNumCalculatedAngles];
+    
+    /*! @brief The column of packed Effort qualities. */
+    const uint8_t * efforts;
+    
+    /*! @brief The column of Height levels. */
+    const uint8_t * heights;
+    
+    /*! @brief The column of calculated fitness scores. */
+    realType * scores;
+    
+    /*! @brief The fitness classification tables. */
+    const FitnessTables * tables;
+    
+    /*! @brief The fitness coefficients to be applied. */
+    const FitnessCoefficients * coefficients;
+    
+    /*! @brief The Bartenieff class for each quadrant signature. */
+    const uint8_t * bartenieffClasses;
+    
+    /*! @brief The value of pi used by RadiansToDegrees. */
+    realType pi;
+    
+    /*! @brief The angle (in radians) beyond which two limbs are considered to be apart. */
+    realType critAngle;
+    
+    /*! @brief The fitness coefficient for Bartenieff contralateral configurations. */
+    realType contralateral;
+    
+    /*! @brief The fitness coefficient for Bartenieff distal configurations. */
+    realType distal;
+    
+    /*! @brief The fitness coefficient for Bartenieff homolateral configurations. */
+    realType homolateral;
+    
+    /*! @brief The fitness coefficient for Bartenieff homologous configurations. */
+    realType homologous;
+    
+    /*! @brief The fitness coefficient for Bartenieff medial configurations. */
+    realType medial;
+    
+    /*! @brief The Effort fitness coefficient for each set of packed Effort qualities. */
+    realType effortFactors[kNumEffortCodes];
+    
+    /*! @brief The Height fitness coefficient for each Height level. */
+    realType heightFactors[kNumHeightCodes];
+    
+    /*! @brief The quadrant score contribution for each Height level. */
+    int heightScores[kNumHeightCodes];
+    
+}; // FitnessColumns
+
+/*! @brief The bits of a packed Effort value that are significant. */
+static const uint8_t kEffortMask = 0x0F;
+
+/*! @brief The bits of a Height level that are significant. */
+static const uint8_t kHeightMask = 0x07;
+
+/*! @brief The number of fixed attributes that can be swapped. */
+static const size_t kNumFixedAttributes = 5;
+
+/*! @brief The smallest number of poses to allocate room for. */
+static const size_t kMinimumCapacity = 16;
+
+/*! @brief The fitness kernel that has been requested. */
+static PoseBatch::FitnessKernel lRequestedKernel = PoseBatch::kFitnessKernelAutomatic;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the size of a column, rounded up to the column alignment.
+ @param numPoses The number of poses in the column.
+ @param elementSize The size of each element of the column.
+ @returns The size of the column, in bytes. */
+static size_t
+columnBytes(const size_t numPoses,
+            const size_t elementSize)
+{
+    size_t numBytes = (numPoses * elementSize);
+    
+    return (((numBytes + PoseBatch::kColumnAlignment - 1) / PoseBatch::kColumnAlignment) *
+            PoseBatch::kColumnAlignment);
+} // columnBytes
+
+/*! @brief Return the upper bound for an angle of a pose.
+ @param angleIndex The index of the angle.
+ @returns The upper bound for the angle, in degrees. */
+static realType
+maximumAngle(const size_t angleIndex)
+{
+    realType result;
+    
+    switch (angleIndex)
+    {
+        case Skeleton::kLeftElbowToWrist :
+        case Skeleton::kRightElbowToWrist :
+        case Skeleton::kLeftKneeToFoot :
+        case Skeleton::kRightKneeToFoot :
+            result = 180;
+            break;
+            
+        default :
+            result = 360;
+            break;
+            
+    }
+    return result;
+} // maximumAngle
+
+/*! @brief Exchange a bit between two packed values.
+ @param first The first packed value.
+ @param second The second packed value.
+ @param bit The bit to be exchanged. */
+static inline void
+swapBit(uint8_t &     first,
+        uint8_t &     second,
+        const uint8_t bit)
+{
+    uint8_t difference = static_cast<uint8_t>((first ^ second) & bit);
+    
+    first ^= difference;
+    second ^= difference;
+} // swapBit
+
+/*! @brief Return the fitness factors of a pose.
+ @param angles The columns of angles (in radians).
+ @param efforts The column of packed Effort qualities.
+ @param heights The column of Height levels.
+ @param tables The fitness classification tables.
+ @param critAngle The angle (in radians) beyond which two limbs are considered to be apart.
+ @param index The index of the pose.
+ @returns The fitness factors of the pose. */
+static inline FitnessFactors
+classifyPose(const realType * const * angles,
+             const uint8_t *          efforts,
+             const uint8_t *          heights,
+             const FitnessTables &    tables,
+             const realType           critAngle,
+             const size_t             index)
+{
+    realType       lse = angles[Skeleton::kLeftShoulderToElbow][index];
+    realType       lew = angles[Skeleton::kLeftElbowToWrist][index];
+    realType       rse = angles[Skeleton::kRightShoulderToElbow][index];
+    realType       rew = angles[Skeleton::kRightElbowToWrist][index];
+    realType       lhk = angles[Skeleton::kLeftHipToKnee][index];
+    realType       lkf = angles[Skeleton::kLeftKneeToFoot][index];
+    realType       rhk = angles[Skeleton::kRightHipToKnee][index];
+    realType       rkf = angles[Skeleton::kRightKneeToFoot][index];
+    // Calculate the quadrants, in the same way as Skeleton::determineQuadrants:
+    int            lseQuadrant = MapAngleToQuadrant(lse, 90, 1, 180, 2, 270, 1, 4);
+    int            rseQuadrant = MapAngleToQuadrant(rse, 90, 2, 180, 1, 270, 4, 1);
+    int            lewQuadrant = MapAngleToQuadrant(lew, 45, 1, 90, 2, 135, 1, 4);
+    int            rewQuadrant = MapAngleToQuadrant(rew, 45, 2, 90, 1, 135, 4, 1);
+    int            lhkQuadrant = MapAngleToQuadrant(lhk, 90, 4, 180, 1, 270, 2, 1);
+    int            rhkQuadrant = MapAngleToQuadrant(rhk, 90, 1, 180, 4, 270, 1, 2);
+    int            lkfQuadrant = MapAngleToQuadrant(lkf, 45, 4, 90, 1, 135, 2, 1);
+    int            rkfQuadrant = MapAngleToQuadrant(rkf, 45, 1, 90, 4, 135, 1, 2);
+    int            quadrantScore = (lhkQuadrant + lkfQuadrant + rhkQuadrant + rkfQuadrant +
+                                    lseQuadrant + lewQuadrant + rseQuadrant + rewQuadrant);
+    size_t         signature = (QuadrantSignatureBits(Skeleton::kLeftHipToKnee, lhkQuadrant) |
+                                QuadrantSignatureBits(Skeleton::kLeftKneeToFoot, lkfQuadrant) |
+                                QuadrantSignatureBits(Skeleton::kRightHipToKnee, rhkQuadrant) |
+                                QuadrantSignatureBits(Skeleton::kRightKneeToFoot, rkfQuadrant) |
+                                QuadrantSignatureBits(Skeleton::kLeftShoulderToElbow,
+                                                      lseQuadrant) |
+                                QuadrantSignatureBits(Skeleton::kLeftElbowToWrist, lewQuadrant) |
+                                QuadrantSignatureBits(Skeleton::kRightShoulderToElbow,
+                                                      rseQuadrant) |
+                                QuadrantSignatureBits(Skeleton::kRightElbowToWrist,
+                                                      rewQuadrant));
+    uint8_t        effort = (efforts[index] & kEffortMask);
+    uint8_t        height = (heights[index] & kHeightMask);
+    FitnessFactors result;
+    
+    result.bartenieffClass = tables.bartenieffClasses[signature];
+    // The angles decide the configurations that the quadrants alone cannot.
+    if ((kBartenieffClassDistal != result.bartenieffClass) &&
+        (kBartenieffClassMedial != result.bartenieffClass))
+    {
+        if (((std::abs(lse - lhk) > critAngle) && (std::abs(lew - lkf) > critAngle)) ||
+            ((std::abs(rse - rhk) > critAngle) && (std::abs(rew - rkf) > critAngle)))
+        {
+            // Homolateral
+            result.bartenieffClass = kBartenieffClassHomolateral;
+        }
+        else if (((std::abs(lse - rhk) > critAngle) && (std::abs(lew - rkf) > critAngle)) ||
+                 ((std::abs(rse - lhk) > critAngle) && (std::abs(rew - lkf) > critAngle)))
+        {
+            // Contralateral
+            result.bartenieffClass = kBartenieffClassContralateral;
+        }
+    }
+    // Laban Effort and Height, from the tables:
+    result.effortClass = tables.effortClasses[effort];
+    if (tables.bentLegs[height])
+    {
+        // No leg is extended - cannot jump without legs in a crouch!
+        result.heightClass = kHeightClassUnextendedLegs;
+    }
+    else
+    {
+        result.heightClass = kHeightClassNone;
+    }
+    result.quadrantScore = static_cast<uint8_t>(quadrantScore + tables.heightScores[height]);
+    return result;
+} // classifyPose
+
+/*! @brief Determine the fitness values for a range of poses, one pose at a time.
+ @param columns The columns and coefficients to be used.
+ @param first The index of the first pose to be updated.
+ @param last The index past the last pose to be updated. */
+static void
+updateFitnessScalar(const FitnessColumns & columns,
+                    const size_t           first,
+                    const size_t           last)
+{
+    for (size_t ii = first; last > ii; ++ii)
+    {
+        columns.scores[ii] = ScoreFitnessFactors(*columns.coefficients,
+                                                 classifyPose(columns.angles, columns.efforts,
+                                                              columns.heights, *columns.tables,
+                                                              columns.critAngle, ii));
+    }
+} // updateFitnessScalar
+
+#if defined(VECTOR_FITNESS_)
+/*! @brief Convert eight angles (in radians) to the desired quadrants, in the same way as
+ MapAngleToQuadrant.
+ @param angle The input angles.
+ @param pi The value of pi used by RadiansToDegrees.
+ @param firstAngle The angle corresponding to the first quadrant.
+ @param firstQuadrant The quadrant value for the first quadrant.
+ @param secondAngle The angle corresponding to the second quadrant.
+ @param secondQuadrant The quadrant value for the second quadrant.
+ @param thirdAngle The angle corresponding to the third quadrant.
+ @param thirdQuadrant The quadrant value for the third quadrant.
+ @param fourthQuadrant The quadrant value for the fourth quadrant.
+ @returns The resulting quadrants. */
+__attribute__((target("avx2"))) static inline __m256
+mapAngleToQuadrantAVX2(const __m256   angle,
+                       const __m256   pi,
+                       const realType firstAngle,
+                       const realType firstQuadrant,
+                       const realType secondAngle,
+                       const realType secondQuadrant,
+                       const realType thirdAngle,
+                       const realType thirdQuadrant,
+                       const realType fourthQuadrant)
+{
+    // Same operation order as RadiansToDegrees, so that the rounding is identical.
+    __m256 asDegrees = _mm256_sub_ps(_mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(180), angle),
+                                                   pi), _mm256_set1_ps(gEpsilon));
+    __m256 result = _mm256_set1_ps(fourthQuadrant);
+    
+    // Apply the tests from last to first, so that the first successful test wins.
+    result = _mm256_blendv_ps(result, _mm256_set1_ps(thirdQuadrant),
+                              _mm256_cmp_ps(_mm256_set1_ps(thirdAngle), asDegrees, _CMP_GE_OQ));
+    result = _mm256_blendv_ps(result, _mm256_set1_ps(secondQuadrant),
+                              _mm256_cmp_ps(_mm256_set1_ps(secondAngle), asDegrees, _CMP_GE_OQ));
+    result = _mm256_blendv_ps(result, _mm256_set1_ps(firstQuadrant),
+                              _mm256_cmp_ps(_mm256_set1_ps(firstAngle), asDegrees, _CMP_GE_OQ));
+    return result;
+} // mapAngleToQuadrantAVX2
+
+/*! @brief Load eight bytes and widen them to 32-bit integers.
+ @param source The bytes to be loaded.
+ @returns The widened values. */
+__attribute__((target("avx2"))) static inline __m256i
+loadBytesAVX2(const uint8_t * source)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(source)));
+} // loadBytesAVX2
+
+/*! @brief Return a mask of the lanes where two pairs of angles both differ by more than a
+ critical angle.
+ @param first The first angles of the first pair.
+ @param second The second angles of the first pair.
+ @param third The first angles of the second pair.
+ @param fourth The second angles of the second pair.
+ @param critAngle The critical angle.
+ @returns The mask of the lanes where both pairs differ by more than the critical angle. */
+__attribute__((target("avx2"))) static inline __m256
+bothApartAVX2(const __m256 first,
+              const __m256 second,
+              const __m256 third,
+              const __m256 fourth,
+              const __m256 critAngle)
+{
+    __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 firstDiff = _mm256_and_ps(_mm256_sub_ps(first, second), absMask);
+    __m256 secondDiff = _mm256_and_ps(_mm256_sub_ps(third, fourth), absMask);
+    
+    return _mm256_and_ps(_mm256_cmp_ps(firstDiff, critAngle, _CMP_GT_OQ),
+                         _mm256_cmp_ps(secondDiff, critAngle, _CMP_GT_OQ));
+} // bothApartAVX2
+
+/*! @brief Determine the fitness values for a range of poses, eight poses at a time.
+ @param columns The columns and coefficients to be used.
+ @param first The index of the first pose to be updated.
+ @param last The index past the last pose to be updated. */
+__attribute__((target("avx2"))) static void
+updateFitnessAVX2(const FitnessColumns & columns,
+                  const size_t           first,
+                  const size_t           last)
+{
+    const realType * lsePtr = columns.angles[Skeleton::kLeftShoulderToElbow];
+    const realType * lewPtr = columns.angles[Skeleton::kLeftElbowToWrist];
+    const realType * rsePtr = columns.angles[Skeleton::kRightShoulderToElbow];
+    const realType * rewPtr = columns.angles[Skeleton::kRightElbowToWrist];
+    const realType * lhkPtr = columns.angles[Skeleton::kLeftHipToKnee];
+    const realType * lkfPtr = columns.angles[Skeleton::kLeftKneeToFoot];
+    const realType * rhkPtr = columns.angles[Skeleton::kRightHipToKnee];
+    const realType * rkfPtr = columns.angles[Skeleton::kRightKneeToFoot];
+    __m256           pi = _mm256_set1_ps(columns.pi);
+    __m256           critAngle = _mm256_set1_ps(columns.critAngle);
+    __m256i          effortMask = _mm256_set1_epi32(kEffortMask);
+    __m256i          heightMask = _mm256_set1_epi32(kHeightMask);
+    size_t           ii = first;
+    
+    for ( ; last >= (ii + 8); ii += 8)
+    {
+        __m256 lse = _mm256_loadu_ps(lsePtr + ii);
+        __m256 lew = _mm256_loadu_ps(lewPtr + ii);
+        __m256 rse = _mm256_loadu_ps(rsePtr + ii);
+        __m256 rew = _mm256_loadu_ps(rewPtr + ii);
+        __m256 lhk = _mm256_loadu_ps(lhkPtr + ii);
+        __m256 lkf = _mm256_loadu_ps(lkfPtr + ii);
+        __m256 rhk = _mm256_loadu_ps(rhkPtr + ii);
+        __m256 rkf = _mm256_loadu_ps(rkfPtr + ii);
+        __m256 lseQuadrant = mapAngleToQuadrantAVX2(lse, pi, 90, 1, 180, 2, 270, 1, 4);
+        __m256 rseQuadrant = mapAngleToQuadrantAVX2(rse, pi, 90, 2, 180, 1, 270, 4, 1);
+        __m256 lewQuadrant = mapAngleToQuadrantAVX2(lew, pi, 45, 1, 90, 2, 135, 1, 4);
+        __m256 rewQuadrant = mapAngleToQuadrantAVX2(rew, pi, 45, 2, 90, 1, 135, 4, 1);
+        __m256 lhkQuadrant = mapAngleToQuadrantAVX2(lhk, pi, 90, 4, 180, 1, 270, 2, 1);
+        __m256 rhkQuadrant = mapAngleToQuadrantAVX2(rhk, pi, 90, 1, 180, 4, 270, 1, 2);
+        __m256 lkfQuadrant = mapAngleToQuadrantAVX2(lkf, pi, 45, 4, 90, 1, 135, 2, 1);
+        __m256 rkfQuadrant = mapAngleToQuadrantAVX2(rkf, pi, 45, 1, 90, 4, 135, 1, 2);
+        // The quadrant values are small integers, so the sums are exact.
+        __m256 quadrantScore = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(lhkQuadrant,
+                                                                         lkfQuadrant),
+                                                           _mm256_add_ps(rhkQuadrant,
+                                                                         rkfQuadrant)),
+                                             _mm256_add_ps(_mm256_add_ps(lseQuadrant,
+                                                                         lewQuadrant),
+                                                           _mm256_add_ps(rseQuadrant,
+                                                                         rewQuadrant)));
+        __m256 limbsAligned = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(lseQuadrant, lewQuadrant,
+                                                                        _CMP_EQ_OQ),
+                                                          _mm256_cmp_ps(rseQuadrant, rewQuadrant,
+                                                                        _CMP_EQ_OQ)),
+                                            _mm256_and_ps(_mm256_cmp_ps(lhkQuadrant, lkfQuadrant,
+                                                                        _CMP_EQ_OQ),
+                                                          _mm256_cmp_ps(rhkQuadrant, rkfQuadrant,
+                                                                        _CMP_EQ_OQ)));
+        __m256 isDistal = _mm256_and_ps(limbsAligned, _mm256_cmp_ps(quadrantScore,
+                                                                    _mm256_set1_ps(8),
+                                                                    _CMP_EQ_OQ));
+        __m256 isMedial = _mm256_and_ps(limbsAligned, _mm256_cmp_ps(quadrantScore,
+                                                                    _mm256_set1_ps(12),
+                                                                    _CMP_EQ_OQ));
+        __m256 isHomolateral = _mm256_or_ps(bothApartAVX2(lse, lhk, lew, lkf, critAngle),
+                                            bothApartAVX2(rse, rhk, rew, rkf, critAngle));
+        __m256 isContralateral = _mm256_or_ps(bothApartAVX2(lse, rhk, lew, rkf, critAngle),
+                                              bothApartAVX2(rse, lhk, rew, lkf, critAngle));
+        __m256 isHomologous = _mm256_or_ps(_mm256_and_ps(_mm256_cmp_ps(lseQuadrant, rseQuadrant,
+                                                                       _CMP_EQ_OQ),
+                                                         _mm256_cmp_ps(lewQuadrant, rewQuadrant,
+                                                                       _CMP_EQ_OQ)),
+                                           _mm256_and_ps(_mm256_cmp_ps(lhkQuadrant, rhkQuadrant,
+                                                                       _CMP_EQ_OQ),
+                                                         _mm256_cmp_ps(lkfQuadrant, rkfQuadrant,
+                                                                       _CMP_EQ_OQ)));
+        // Apply the Bartenieff tests from last to first, so that the first successful test wins.
+        __m256 bartenieffFactor = _mm256_setzero_ps();
+        
+        bartenieffFactor = _mm256_blendv_ps(bartenieffFactor, _mm256_set1_ps(columns.homologous),
+                                            isHomologous);
+        bartenieffFactor = _mm256_blendv_ps(bartenieffFactor,
+                                            _mm256_set1_ps(columns.contralateral),
+                                            isContralateral);
+        bartenieffFactor = _mm256_blendv_ps(bartenieffFactor, _mm256_set1_ps(columns.homolateral),
+                                            isHomolateral);
+        bartenieffFactor = _mm256_blendv_ps(bartenieffFactor, _mm256_set1_ps(columns.medial),
+                                            isMedial);
+        bartenieffFactor = _mm256_blendv_ps(bartenieffFactor, _mm256_set1_ps(columns.distal),
+                                            isDistal);
+        // Laban Effort and Height, from the per-call tables:
+        __m256i effort = _mm256_and_si256(loadBytesAVX2(columns.efforts + ii), effortMask);
+        __m256i height = _mm256_and_si256(loadBytesAVX2(columns.heights + ii), heightMask);
+        __m256  effortFactor = _mm256_i32gather_ps(columns.effortFactors, effort, 4);
+        __m256  heightFactor = _mm256_i32gather_ps(columns.heightFactors, height, 4);
+        
+        __m256i heightScore = _mm256_i32gather_epi32(columns.heightScores, height, 4);
+        
+        quadrantScore = _mm256_add_ps(quadrantScore, _mm256_cvtepi32_ps(heightScore));
+        _mm256_storeu_ps(columns.scores + ii,
+                         _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(bartenieffFactor, effortFactor),
+                                                     heightFactor), quadrantScore));
+    }
+    updateFitnessScalar(columns, ii, last);
+} // updateFitnessAVX2
+
+/*! @brief Convert four angles (in radians) to the desired quadrants, in the same way as
+ MapAngleToQuadrant.
+ @param angle The input angles.
+ @param pi The value of pi used by RadiansToDegrees.
+ @param firstAngle The angle corresponding to the first quadrant.
+ @param firstQuadrant The quadrant value for the first quadrant.
+ @param secondAngle The angle corresponding to the second quadrant.
+ @param secondQuadrant The quadrant value for the second quadrant.
+ @param thirdAngle The angle corresponding to the third quadrant.
+ @param thirdQuadrant The quadrant value for the third quadrant.
+ @param fourthQuadrant The quadrant value for the fourth quadrant.
+ @returns The resulting quadrants. */
+__attribute__((target("sse4.1"))) static inline __m128
+mapAngleToQuadrantSSE(const __m128   angle,
+                      const __m128   pi,
+                      const realType firstAngle,
+                      const realType firstQuadrant,
+                      const realType secondAngle,
+                      const realType secondQuadrant,
+                      const realType thirdAngle,
+                      const realType thirdQuadrant,
+                      const realType fourthQuadrant)
+{
+    // Same operation order as RadiansToDegrees, so that the rounding is identical.
+    __m128 asDegrees = _mm_sub_ps(_mm_div_ps(_mm_mul_ps(_mm_set1_ps(180), angle), pi),
+                                  _mm_set1_ps(gEpsilon));
+    __m128 result = _mm_set1_ps(fourthQuadrant);
+    
+    // Apply the tests from last to first, so that the first successful test wins.
+    result = _mm_blendv_ps(result, _mm_set1_ps(thirdQuadrant),
+                           _mm_cmpge_ps(_mm_set1_ps(thirdAngle), asDegrees));
+    result = _mm_blendv_ps(result, _mm_set1_ps(secondQuadrant),
+                           _mm_cmpge_ps(_mm_set1_ps(secondAngle), asDegrees));
+    result = _mm_blendv_ps(result, _mm_set1_ps(firstQuadrant),
+                           _mm_cmpge_ps(_mm_set1_ps(firstAngle), asDegrees));
+    return result;
+} // mapAngleToQuadrantSSE
+
+/*! @brief Return a mask of the lanes where two pairs of angles both differ by more than a
+ critical angle.
+ @param first The first angles of the first pair.
+ @param second The second angles of the first pair.
+ @param third The first angles of the second pair.
+ @param fourth The second angles of the second pair.
+ @param critAngle The critical angle.
+ @returns The mask of the lanes where both pairs differ by more than the critical angle. */
+__attribute__((target("sse4.1"))) static inline __m128
+bothApartSSE(const __m128 first,
+             const __m128 second,
+             const __m128 third,
+             const __m128 fourth,
+             const __m128 critAngle)
+{
+    __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 firstDiff = _mm_and_ps(_mm_sub_ps(first, second), absMask);
+    __m128 secondDiff = _mm_and_ps(_mm_sub_ps(third, fourth), absMask);
+    
+    return _mm_and_ps(_mm_cmpgt_ps(firstDiff, critAngle), _mm_cmpgt_ps(secondDiff, critAngle));
+} // bothApartSSE
+
+/*! @brief Determine the fitness values for a range of poses, four poses at a time.
+ @param columns The columns and coefficients to be used.
+ @param first The index of the first pose to be updated.
+ @param last The index past the last pose to be updated. */
+__attribute__((target("sse4.1"))) static void
+updateFitnessSSE(const FitnessColumns & columns,
+                 const size_t           first,
+                 const size_t           last)
+{
+    const realType * lsePtr = columns.angles[Skeleton::kLeftShoulderToElbow];
+    const realType * lewPtr = columns.angles[Skeleton::kLeftElbowToWrist];
+    const realType * rsePtr = columns.angles[Skeleton::kRightShoulderToElbow];
+    const realType * rewPtr = columns.angles[Skeleton::kRightElbowToWrist];
+    const realType * lhkPtr = columns.angles[Skeleton::kLeftHipToKnee];
+    const realType * lkfPtr = columns.angles[Skeleton::kLeftKneeToFoot];
+    const realType * rhkPtr = columns.angles[Skeleton::kRightHipToKnee];
+    const realType * rkfPtr = columns.angles[Skeleton::kRightKneeToFoot];
+    __m128           pi = _mm_set1_ps(columns.pi);
+    __m128           critAngle = _mm_set1_ps(columns.critAngle);
+    size_t           ii = first;
+    
+    for ( ; last >= (ii + 4); ii += 4)
+    {
+        __m128 lse = _mm_loadu_ps(lsePtr + ii);
+        __m128 lew = _mm_loadu_ps(lewPtr + ii);
+        __m128 rse = _mm_loadu_ps(rsePtr + ii);
+        __m128 rew = _mm_loadu_ps(rewPtr + ii);
+        __m128 lhk = _mm_loadu_ps(lhkPtr + ii);
+        __m128 lkf = _mm_loadu_ps(lkfPtr + ii);
+        __m128 rhk = _mm_loadu_ps(rhkPtr + ii);
+        __m128 rkf = _mm_loadu_ps(rkfPtr + ii);
+        __m128 lseQuadrant = mapAngleToQuadrantSSE(lse, pi, 90, 1, 180, 2, 270, 1, 4);
+        __m128 rseQuadrant = mapAngleToQuadrantSSE(rse, pi, 90, 2, 180, 1, 270, 4, 1);
+        __m128 lewQuadrant = mapAngleToQuadrantSSE(lew, pi, 45, 1, 90, 2, 135, 1, 4);
+        __m128 rewQuadrant = mapAngleToQuadrantSSE(rew, pi, 45, 2, 90, 1, 135, 4, 1);
+        __m128 lhkQuadrant = mapAngleToQuadrantSSE(lhk, pi, 90, 4, 180, 1, 270, 2, 1);
+        __m128 rhkQuadrant = mapAngleToQuadrantSSE(rhk, pi, 90, 1, 180, 4, 270, 1, 2);
+        __m128 lkfQuadrant = mapAngleToQuadrantSSE(lkf, pi, 45, 4, 90, 1, 135, 2, 1);
+        __m128 rkfQuadrant = mapAngleToQuadrantSSE(rkf, pi, 45, 1, 90, 4, 135, 1, 2);
+        // The quadrant values are small integers, so the sums are exact.
+        __m128 quadrantScore = _mm_add_ps(_mm_add_ps(_mm_add_ps(lhkQuadrant, lkfQuadrant),
+                                                     _mm_add_ps(rhkQuadrant, rkfQuadrant)),
+                                          _mm_add_ps(_mm_add_ps(lseQuadrant, lewQuadrant),
+                                                     _mm_add_ps(rseQuadrant, rewQuadrant)));
+        __m128 limbsAligned = _mm_and_ps(_mm_and_ps(_mm_cmpeq_ps(lseQuadrant, lewQuadrant),
+                                                    _mm_cmpeq_ps(rseQuadrant, rewQuadrant)),
+                                         _mm_and_ps(_mm_cmpeq_ps(lhkQuadrant, lkfQuadrant),
+                                                    _mm_cmpeq_ps(rhkQuadrant, rkfQuadrant)));
+        __m128 isDistal = _mm_and_ps(limbsAligned, _mm_cmpeq_ps(quadrantScore, _mm_set1_ps(8)));
+        __m128 isMedial = _mm_and_ps(limbsAligned, _mm_cmpeq_ps(quadrantScore, _mm_set1_ps(12)));
+        __m128 isHomolateral = _mm_or_ps(bothApartSSE(lse, lhk, lew, lkf, critAngle),
+                                         bothApartSSE(rse, rhk, rew, rkf, critAngle));
+        __m128 isContralateral = _mm_or_ps(bothApartSSE(lse, rhk, lew, rkf, critAngle),
+                                           bothApartSSE(rse, lhk, rew, lkf, critAngle));
+        __m128 isHomologous = _mm_or_ps(_mm_and_ps(_mm_cmpeq_ps(lseQuadrant, rseQuadrant),
+                                                   _mm_cmpeq_ps(lewQuadrant, rewQuadrant)),
+                                        _mm_and_ps(_mm_cmpeq_ps(lhkQuadrant, rhkQuadrant),
+                                                   _mm_cmpeq_ps(lkfQuadrant, rkfQuadrant)));
+        // Apply the Bartenieff tests from last to first, so that the first successful test wins.
+        __m128 bartenieffFactor = _mm_setzero_ps();
+        
+        bartenieffFactor = _mm_blendv_ps(bartenieffFactor, _mm_set1_ps(columns.homologous),
+                                         isHomologous);
+        bartenieffFactor = _mm_blendv_ps(bartenieffFactor, _mm_set1_ps(columns.contralateral),
+                                         isContralateral);
+        bartenieffFactor = _mm_blendv_ps(bartenieffFactor, _mm_set1_ps(columns.homolateral),
+                                         isHomolateral);
+        bartenieffFactor = _mm_blendv_ps(bartenieffFactor, _mm_set1_ps(columns.medial),
+                                         isMedial);
+        bartenieffFactor = _mm_blendv_ps(bartenieffFactor, _mm_set1_ps(columns.distal),
+                                         isDistal);
+        // Laban Effort and Height, from the per-call tables; there is no gather before AVX2.
+        realType effortFactors[4];
+        realType heightFactors[4];
+        realType heightScores[4];
+        
+        for (size_t jj = 0; 4 > jj; ++jj)
+        {
+            uint8_t effort = (columns.efforts[ii + jj] & kEffortMask);
+            uint8_t height = (columns.heights[ii + jj] & kHeightMask);
+            
+            effortFactors[jj] = columns.effortFactors[effort];
+            heightFactors[jj] = columns.heightFactors[height];
+            heightScores[jj] = static_cast<realType>(columns.heightScores[height]);
+        }
+        quadrantScore = _mm_add_ps(quadrantScore, _mm_loadu_ps(heightScores));
+        _mm_storeu_ps(columns.scores + ii,
+                      _mm_mul_ps(_mm_add_ps(_mm_add_ps(bartenieffFactor,
+                                                       _mm_loadu_ps(effortFactors)),
+                                            _mm_loadu_ps(heightFactors)), quadrantScore));
+    }
+    updateFitnessScalar(columns, ii, last);
+} // updateFitnessSSE
+#endif // defined(VECTOR_FITNESS_)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+PoseBatch::FitnessKernel
+PoseBatch::GetFitnessKernel(void)
+{
+    FitnessKernel result = lRequestedKernel;
+    
+    if (kFitnessKernelAutomatic == result)
+    {
+        if (IsFitnessKernelSupported(kFitnessKernelAVX2))
+        {
+            result = kFitnessKernelAVX2;
+        }
+        else if (IsFitnessKernelSupported(kFitnessKernelSSE))
+        {
+            result = kFitnessKernelSSE;
+        }
+        else
+        {
+            result = kFitnessKernelScalar;
+        }
+    }
+    return result;
+} // PoseBatch::GetFitnessKernel
+
+bool
+PoseBatch::IsFitnessKernelSupported(const FitnessKernel kernel)
+{
+    bool result;
+    
+    switch (kernel)
+    {
+        case kFitnessKernelAutomatic :
+        case kFitnessKernelScalar :
+            result = true;
+            break;
+            
+#if defined(VECTOR_FITNESS_)
+        case kFitnessKernelSSE :
+            result = (0 != __builtin_cpu_supports("sse4.1"));
+            break;
+            
+        case kFitnessKernelAVX2 :
+            result = (0 != __builtin_cpu_supports("avx2"));
+            break;
+            
+#endif // defined(VECTOR_FITNESS_)
+        default :
+            result = false;
+            break;
+            
+    }
+    return result;
+} // PoseBatch::IsFitnessKernelSupported
+
+uint8_t
+PoseBatch::PackEffort(const WeightQuality weight,
+                      const SpaceQuality  space,
+                      const TimeQuality   time,
+                      const FlowQuality   flow)
+{
+    uint8_t result = 0;
+    
+    if (kWeightStrong == weight)
+    {
+        result |= kEffortWeightStrong;
+    }
+    if (kSpaceDirect == space)
+    {
+        result |= kEffortSpaceDirect;
+    }
+    if (kTimeSudden == time)
+    {
+        result |= kEffortTimeSudden;
+    }
+    if (kFlowBound == flow)
+    {
+        result |= kEffortFlowBound;
+    }
+    return result;
+} // PoseBatch::PackEffort
+
+bool
+PoseBatch::SetFitnessKernel(const FitnessKernel kernel)
+{
+    bool result = IsFitnessKernelSupported(kernel);
+    
+    if (result)
+    {
+        lRequestedKernel = kernel;
+    }
+    return result;
+} // PoseBatch::SetFitnessKernel
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PoseBatch::PoseBatch(void) :
+    _scores(nullptr), _efforts(nullptr), _heights(nullptr), _marks(nullptr), _storage(nullptr),
+    _capacity(0), _size(0)
+{
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        _angles[ii] = nullptr;
+    }
+} // PoseBatch::PoseBatch
+
+PoseBatch::PoseBatch(const size_t numPoses) :
+    _scores(nullptr), _efforts(nullptr), _heights(nullptr), _marks(nullptr), _storage(nullptr),
+    _capacity(0), _size(0)
+{
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        _angles[ii] = nullptr;
+    }
+    resize(numPoses);
+} // PoseBatch::PoseBatch
+
+PoseBatch::~PoseBatch(void)
+{
+    ReleaseAligned(_storage);
+} // PoseBatch::~PoseBatch
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+PoseBatch::append(const Skeleton & aSkeleton)
+{
+    size_t index = _size;
+    
+    resize(_size + 1);
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        _angles[ii][index] = aSkeleton.getAngle(ii);
+    }
+    _scores[index] = aSkeleton.getFitnessScore();
+    _efforts[index] = PackEffort(aSkeleton.getWeight(), aSkeleton.getSpace(), aSkeleton.getTime(),
+                                 aSkeleton.getFlow());
+    _heights[index] = static_cast<uint8_t>(aSkeleton.getHeight());
+    _marks[index] = 0;
+} // PoseBatch::append
+
+void
+PoseBatch::append(const PoseBatch & other,
+                  const size_t      otherIndex)
+{
+    size_t index = _size;
+    
+    resize(_size + 1);
+    copyPose(index, other, otherIndex);
+} // PoseBatch::append
+
+void
+PoseBatch::clearMarks(void)
+{
+    memset(_marks, 0, _size);
+} // PoseBatch::clearMarks
+
+void
+PoseBatch::copyPose(const size_t      index,
+                    const PoseBatch & other,
+                    const size_t      otherIndex)
+{
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        _angles[ii][index] = other._angles[ii][otherIndex];
+    }
+    _scores[index] = other._scores[otherIndex];
+    _efforts[index] = other._efforts[otherIndex];
+    _heights[index] = other._heights[otherIndex];
+    _marks[index] = 0;
+} // PoseBatch::copyPose
+
+glm::quat
+PoseBatch::getAngleAsQuaternion(const size_t index,
+                                const size_t angleIndex)
+const
+{
+    realType angle;
+    
+    if (angleIndex < Skeleton::kNumCalculatedAngles)
+    {
+        angle = _angles[angleIndex][index];
+    }
+    else
+    {
+        angle = RandomAngle(360);
+    }
+    return glm::quat_cast(glm::rotate(glm::mat4(1), angle, glm::vec3(0, 0, 1)));
+} // PoseBatch::getAngleAsQuaternion
+
+FitnessFactors
+PoseBatch::getFitnessFactors(const size_t index)
+const
+{
+    return classifyPose(_angles, _efforts, _heights, GetFitnessTables(), DegreesToRadians(30),
+                        index);
+} // PoseBatch::getFitnessFactors
+
+void
+PoseBatch::mutate(const size_t      index,
+                  RandomGenerator & generator)
+{
+    size_t whichAngle = generator.nextUnsigned(Skeleton::kNumCalculatedAngles - 1);
+    
+    switch (whichAngle)
+    {
+        case Skeleton::kLeftShoulderToElbow :
+        case Skeleton::kRightShoulderToElbow :
+        case Skeleton::kLeftHipToKnee :
+        case Skeleton::kRightHipToKnee :
+            _angles[whichAngle][index] = generator.nextAngle(360);
+            break;
+            
+        case Skeleton::kLeftElbowToWrist :
+        case Skeleton::kRightElbowToWrist :
+        case Skeleton::kLeftKneeToFoot :
+        case Skeleton::kRightKneeToFoot :
+            _angles[whichAngle][index] = generator.nextAngle(180);
+            break;
+            
+        default :
+            break;
+            
+    }
+} // PoseBatch::mutate
+
+void
+PoseBatch::randomize(const size_t      index,
+                     RandomGenerator & generator)
+{
+    _angles[Skeleton::kLeftShoulderToElbow][index] = generator.nextAngle(360);
+    _angles[Skeleton::kLeftElbowToWrist][index] = generator.nextAngle(180);
+    _angles[Skeleton::kRightShoulderToElbow][index] = generator.nextAngle(360);
+    _angles[Skeleton::kRightElbowToWrist][index] = generator.nextAngle(180);
+    _angles[Skeleton::kLeftHipToKnee][index] = generator.nextAngle(360);
+    _angles[Skeleton::kLeftKneeToFoot][index] = generator.nextAngle(180);
+    _angles[Skeleton::kRightHipToKnee][index] = generator.nextAngle(360);
+    _angles[Skeleton::kRightKneeToFoot][index] = generator.nextAngle(180);
+    randomizeQualities(index, generator);
+} // PoseBatch::randomize
+
+void
+PoseBatch::randomizeAll(RandomGenerator & generator)
+{
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        generator.fillAngles(_angles[ii], _size, maximumAngle(ii));
+    }
+    for (size_t ii = 0; _size > ii; ++ii)
+    {
+        randomizeQualities(ii, generator);
+    }
+} // PoseBatch::randomizeAll
+
+void
+PoseBatch::randomizeQualities(const size_t      index,
+                              RandomGenerator & generator)
+{
+    FlowQuality   flow = ((0.5 <= generator.nextReal(0, 1)) ? kFlowBound : kFlowFree);
+    SpaceQuality  space = ((0.5 <= generator.nextReal(0, 1)) ? kSpaceDirect : kSpaceIndirect);
+    TimeQuality   time = ((0.5 <= generator.nextReal(0, 1)) ? kTimeSudden : kTimeSustained);
+    WeightQuality weight = ((0.5 <= generator.nextReal(0, 1)) ? kWeightStrong : kWeightLight);
+    realType      aNumb = generator.nextReal(0, 1);
+    HeightValue   height;
+    
+    if (0.8 <= aNumb)
+    {
+        height = kHeightHigh;
+    }
+    else if (0.6 <= aNumb)
+    {
+        height = kHeightMidHigh;
+    }
+    else if (0.4 <= aNumb)
+    {
+        height = kHeightMiddle;
+    }
+    else if (0.2 <= aNumb)
+    {
+        height = kHeightMidLow;
+    }
+    else
+    {
+        height = kHeightLow;
+    }
+    _efforts[index] = PackEffort(weight, space, time, flow);
+    _heights[index] = static_cast<uint8_t>(height);
+    _scores[index] = 0;
+    _marks[index] = 0;
+} // PoseBatch::randomizeQualities
+
+void
+PoseBatch::reserve(const size_t numPoses)
+{
+    if (_capacity < numPoses)
+    {
+        size_t newCapacity = ((kMinimumCapacity > _capacity) ? kMinimumCapacity : _capacity);
+        
+        for ( ; newCapacity < numPoses; newCapacity *= 2)
+        {
+        }
+        size_t realBytes = columnBytes(newCapacity, sizeof(realType));
+        size_t byteBytes = columnBytes(newCapacity, sizeof(uint8_t));
+        size_t totalBytes = (((Skeleton::kNumCalculatedAngles + 1) * realBytes) + (3 * byteBytes));
+        void * newStorage = AllocateAligned(totalBytes, kColumnAlignment);
+        
+        if (! newStorage)
+        {
+            throw std::bad_alloc();
+        }
+        
+        uint8_t * walker = static_cast<uint8_t *>(newStorage);
+        
+        for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+        {
+            realType * newColumn = reinterpret_cast<realType *>(walker);
+            
+            if (_size)
+            {
+                memcpy(newColumn, _angles[ii], _size * sizeof(realType));
+            }
+            _angles[ii] = newColumn;
+            walker += realBytes;
+        }
+        realType * newScores = reinterpret_cast<realType *>(walker);
+        
+        if (_size)
+        {
+            memcpy(newScores, _scores, _size * sizeof(realType));
+        }
+        _scores = newScores;
+        walker += realBytes;
+        if (_size)
+        {
+            memcpy(walker, _efforts, _size);
+        }
+        _efforts = walker;
+        walker += byteBytes;
+        if (_size)
+        {
+            memcpy(walker, _heights, _size);
+        }
+        _heights = walker;
+        walker += byteBytes;
+        if (_size)
+        {
+            memcpy(walker, _marks, _size);
+        }
+        _marks = walker;
+        ReleaseAligned(_storage);
+        _storage = newStorage;
+        _capacity = newCapacity;
+    }
+} // PoseBatch::reserve
+
+void
+PoseBatch::resize(const size_t numPoses)
+{
+    reserve(numPoses);
+    _size = numPoses;
+} // PoseBatch::resize
+
+void
+PoseBatch::retainMarked(void)
+{
+    size_t kept = 0;
+    
+    for (size_t ii = 0; _size > ii; ++ii)
+    {
+        if (_marks[ii])
+        {
+            if (kept != ii)
+            {
+                copyPose(kept, *this, ii);
+            }
+            _marks[kept] = 0;
+            ++kept;
+        }
+    }
+    _size = kept;
+} // PoseBatch::retainMarked
+
+void
+PoseBatch::swap(PoseBatch & other)
+{
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        std::swap(_angles[ii], other._angles[ii]);
+    }
+    std::swap(_scores, other._scores);
+    std::swap(_efforts, other._efforts);
+    std::swap(_heights, other._heights);
+    std::swap(_marks, other._marks);
+    std::swap(_storage, other._storage);
+    std::swap(_capacity, other._capacity);
+    std::swap(_size, other._size);
+} // PoseBatch::swap
+
+void
+PoseBatch::swapValues(const size_t      index,
+                      const size_t      otherIndex,
+                      const size_t      numSwap,
+                      RandomGenerator & generator)
+{
+    size_t numAttributes = kNumFixedAttributes + Skeleton::kNumCalculatedAngles;
+    size_t realSwap;
+    
+    if (numAttributes < numSwap)
+    {
+        realSwap = numAttributes;
+    }
+    else
+    {
+        realSwap = numSwap;
+    }
+    // Collect a set of distinct indices to swap.
+    bool chosen[kNumFixedAttributes + Skeleton::kNumCalculatedAngles] = { false };
+    
+    for (size_t ii = 0; realSwap > ii; )
+    {
+        size_t anIndex = generator.nextUnsigned(numAttributes - 1);
+        
+        if (! chosen[anIndex])
+        {
+            chosen[anIndex] = true;
+            ++ii;
+        }
+    }
+    for (size_t anIndex = 0; numAttributes > anIndex; ++anIndex)
+    {
+        if (chosen[anIndex])
+        {
+            switch (anIndex)
+            {
+                case 0 :
+                    swapBit(_efforts[index], _efforts[otherIndex], kEffortWeightStrong);
+                    break;
+                    
+                case 1 :
+                    swapBit(_efforts[index], _efforts[otherIndex], kEffortSpaceDirect);
+                    break;
+                    
+                case 2 :
+                    swapBit(_efforts[index], _efforts[otherIndex], kEffortTimeSudden);
+                    break;
+                    
+                case 3 :
+                    swapBit(_efforts[index], _efforts[otherIndex], kEffortFlowBound);
+                    break;
+                    
+                case 4 : // This is (kNumFixedAttributes - 1).
+                    std::swap(_heights[index], _heights[otherIndex]);
+                    break;
+                    
+                default :
+                {
+                    // Angles -
+                    realType * column = _angles[anIndex - kNumFixedAttributes];
+                    
+                    std::swap(column[index], column[otherIndex]);
+                }
+                    break;
+                    
+            }
+        }
+    }
+} // PoseBatch::swapValues
+
+void
+PoseBatch::updateFitness(const FitnessCoefficients & coefficients,
+                         const size_t                first,
+                         const size_t                last)
+{
+    const FitnessTables & tables = GetFitnessTables();
+    FitnessColumns        columns;
+    
+    columns.pi = (4 * static_cast<realType>(atan2(1, 1)));
+    columns.critAngle = DegreesToRadians(30);
+    columns.distal = coefficients.bartenieff[kBartenieffClassDistal];
+    columns.medial = coefficients.bartenieff[kBartenieffClassMedial];
+    columns.homolateral = coefficients.bartenieff[kBartenieffClassHomolateral];
+    columns.contralateral = coefficients.bartenieff[kBartenieffClassContralateral];
+    columns.homologous = coefficients.bartenieff[kBartenieffClassHomologous];
+    for (size_t ii = 0; Skeleton::kNumCalculatedAngles > ii; ++ii)
+    {
+        columns.angles[ii] = _angles[ii];
+    }
+    columns.efforts = _efforts;
+    columns.heights = _heights;
+    columns.scores = _scores;
+    columns.tables = &tables;
+    columns.coefficients = &coefficients;
+    columns.bartenieffClasses = tables.bartenieffClasses.data();
+    for (size_t ii = 0; kNumEffortCodes > ii; ++ii)
+    {
+        columns.effortFactors[ii] = coefficients.effort[tables.effortClasses[ii]];
+    }
+    for (size_t ii = 0; kNumHeightCodes > ii; ++ii)
+    {
+        columns.heightScores[ii] = tables.heightScores[ii];
+        if (tables.bentLegs[ii])
+        {
+            // No leg is extended - cannot jump without legs in a crouch!
+            columns.heightFactors[ii] = coefficients.height[kHeightClassUnextendedLegs];
+        }
+        else
+        {
+            columns.heightFactors[ii] = 0.0;
+        }
+    }
+    switch (GetFitnessKernel())
+    {
+#if defined(VECTOR_FITNESS_)
+        case kFitnessKernelAVX2 :
+            updateFitnessAVX2(columns, first, last);
+            break;
+            
+        case kFitnessKernelSSE :
+            updateFitnessSSE(columns, first, last);
+            break;
+            
+#endif // defined(VECTOR_FITNESS_)
+        default :
+            updateFitnessScalar(columns, first, last);
+            break;
+            
+    }
+} // PoseBatch::updateFitness
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
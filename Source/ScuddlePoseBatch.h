@@ -0,0 +1,428 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePoseBatch.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for PoseBatch objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_PoseBatch_H_))
+# define Scuddle_PoseBatch_H_ /* Header guard */
+
+# include "ScuddleSkeleton.h"
+
+# include <cstdint>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for PoseBatch objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief A set of Skeleton poses, stored column-wise.
+     
+     Each angle of the Skeleton has its own contiguous, aligned column, as do the packed Effort
+     qualities, the Height levels, the fitness scores and the marks, so that operations over the
+     whole set stream through memory rather than visiting one object at a time. */
+    class PoseBatch
+    {
+    public :
+        
+        /*! @brief The implementations of the fitness calculation. */
+        enum FitnessKernel
+        {
+            /*! @brief Use the widest implementation supported by the processor. */
+            kFitnessKernelAutomatic,
+            
+            /*! @brief Calculate one pose at a time. */
+            kFitnessKernelScalar,
+            
+            /*! @brief Calculate four poses at a time, using SSE4.1 instructions. */
+            kFitnessKernelSSE,
+            
+            /*! @brief Calculate eight poses at a time, using AVX2 instructions. */
+            kFitnessKernelAVX2
+            
+        }; // FitnessKernel
+        
+        /*! @brief The constructor. */
+        PoseBatch(void);
+        
+        /*! @brief The constructor.
+         @param numPoses The number of poses to be allocated. */
+        explicit
+        PoseBatch(const size_t numPoses);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~PoseBatch(void);
+        
+        /*! @brief Add a pose to the end of the set.
+         @param aSkeleton The Skeleton whose attributes are to be copied. */
+        void
+        append(const Skeleton & aSkeleton);
+        
+        /*! @brief Add a pose to the end of the set.
+         @param other The set containing the pose to be copied.
+         @param otherIndex The index of the pose to be copied. */
+        void
+        append(const PoseBatch & other,
+               const size_t      otherIndex);
+        
+        /*! @brief Remove all the poses. */
+        void
+        clear(void)
+        {
+            _size = 0;
+        } // clear
+        
+        /*! @brief Unmark a pose.
+         @param index The index of the pose. */
+        void
+        clearMark(const size_t index)
+        {
+            _marks[index] = 0;
+        } // clearMark
+        
+        /*! @brief Unmark all the poses. */
+        void
+        clearMarks(void);
+        
+        /*! @brief Copy a pose.
+         @param index The index of the pose to be replaced.
+         @param other The set containing the pose to be copied.
+         @param otherIndex The index of the pose to be copied. */
+        void
+        copyPose(const size_t      index,
+                 const PoseBatch & other,
+                 const size_t      otherIndex);
+        
+        /*! @brief Return a specific angle (in radians) of a pose.
+         @param index The index of the pose.
+         @param angleIndex The index of the angle to be returned.
+         @returns The specified angle, in radians. */
+        realType
+        getAngle(const size_t index,
+                 const size_t angleIndex)
+        const
+        {
+            return _angles[angleIndex][index];
+        } // getAngle
+        
+        /*! @brief Return a specific angle of a pose as a quaternion.
+         @param index The index of the pose.
+         @param angleIndex The index of the angle to be returned.
+         @returns The specified angle as a quaternion. */
+        glm::quat
+        getAngleAsQuaternion(const size_t index,
+                             const size_t angleIndex)
+        const;
+        
+        /*! @brief Return the column for a specific angle.
+         @param angleIndex The index of the angle column to be returned.
+         @returns The column of angles (in radians). */
+        const realType *
+        getAngleColumn(const size_t angleIndex)
+        const
+        {
+            return _angles[angleIndex];
+        } // getAngleColumn
+        
+        /*! @brief Return the number of poses that can be held without reallocation.
+         @returns The number of poses that can be held without reallocation. */
+        size_t
+        getCapacity(void)
+        const
+        {
+            return _capacity;
+        } // getCapacity
+        
+        /*! @brief Return the packed Effort qualities column.
+         @returns The packed Effort qualities column. */
+        const uint8_t *
+        getEffortColumn(void)
+        const
+        {
+            return _efforts;
+        } // getEffortColumn
+        
+        /*! @brief Return the classification of a pose, as found by Skeleton::updateFitness.
+         @param index The index of the pose.
+         @returns The fitness factors of the pose. */
+        FitnessFactors
+        getFitnessFactors(const size_t index)
+        const;
+        
+        /*! @brief Return the calculated fitness score of a pose.
+         @param index The index of the pose.
+         @returns The calculated fitness score. */
+        realType
+        getFitnessScore(const size_t index)
+        const
+        {
+            return _scores[index];
+        } // getFitnessScore
+        
+        /*! @brief Return the Height level of a pose.
+         @param index The index of the pose.
+         @returns The Height level value. */
+        HeightValue
+        getHeight(const size_t index)
+        const
+        {
+            return static_cast<HeightValue>(_heights[index]);
+        } // getHeight
+        
+        /*! @brief Return the Height level column.
+         @returns The Height level column. */
+        const uint8_t *
+        getHeightColumn(void)
+        const
+        {
+            return _heights;
+        } // getHeightColumn
+        
+        /*! @brief Return the fitness score column.
+         @returns The fitness score column. */
+        const realType *
+        getScoreColumn(void)
+        const
+        {
+            return _scores;
+        } // getScoreColumn
+        
+        /*! @brief Return @c true if a pose is marked.
+         @param index The index of the pose.
+         @returns @c true if the pose is marked. */
+        bool
+        isMarked(const size_t index)
+        const
+        {
+            return (0 != _marks[index]);
+        } // isMarked
+        
+        /*! @brief Mutate a value of a pose.
+         @param index The index of the pose.
+         @param generator The random number generator to use. */
+        void
+        mutate(const size_t      index,
+               RandomGenerator & generator);
+        
+        /*! @brief Set the attributes of a pose to random values.
+         @param index The index of the pose.
+         @param generator The random number generator to use. */
+        void
+        randomize(const size_t      index,
+                  RandomGenerator & generator);
+        
+        /*! @brief Set the attributes of all the poses to random values.
+         
+         The angles are produced a column at a time, using the bulk fill operation of the
+         generator.
+         @param generator The random number generator to use. */
+        void
+        randomizeAll(RandomGenerator & generator);
+        
+        /*! @brief Make room for at least a given number of poses.
+         @param numPoses The number of poses to make room for. */
+        void
+        reserve(const size_t numPoses);
+        
+        /*! @brief Change the number of poses; new poses are not initialized.
+         @param numPoses The new number of poses. */
+        void
+        resize(const size_t numPoses);
+        
+        /*! @brief Keep only the marked poses, preserving their order, and unmark them. */
+        void
+        retainMarked(void);
+        
+        /*! @brief Mark a pose.
+         @param index The index of the pose. */
+        void
+        setMark(const size_t index)
+        {
+            _marks[index] = 1;
+        } // setMark
+        
+        /*! @brief Return the number of poses.
+         @returns The number of poses. */
+        size_t
+        size(void)
+        const
+        {
+            return _size;
+        } // size
+        
+        /*! @brief Exchange the poses, and their storage, with another PoseBatch.
+         @param other The PoseBatch to exchange with. */
+        void
+        swap(PoseBatch & other);
+        
+        /*! @brief Choose a set of values and swap them between two poses.
+         @param index The index of the first pose.
+         @param otherIndex The index of the second pose.
+         @param numSwap The number of values to be exchanged.
+         @param generator The random number generator to use. */
+        void
+        swapValues(const size_t      index,
+                   const size_t      otherIndex,
+                   const size_t      numSwap,
+                   RandomGenerator & generator);
+        
+        /*! @brief Determine the fitness values for a range of poses.
+         
+         The scores are identical to those calculated by Skeleton::updateFitness, whichever
+         fitness kernel is used.
+         @param coefficients The fitness coefficients to be applied.
+         @param first The index of the first pose to be updated.
+         @param last The index past the last pose to be updated. */
+        void
+        updateFitness(const FitnessCoefficients & coefficients,
+                      const size_t                first,
+                      const size_t                last);
+        
+        /*! @brief Return the fitness kernel that will be used by updateFitness.
+         @returns The fitness kernel that will be used; never kFitnessKernelAutomatic. */
+        static FitnessKernel
+        GetFitnessKernel(void);
+        
+        /*! @brief Return @c true if a fitness kernel can be used on this processor.
+         @param kernel The fitness kernel to be checked.
+         @returns @c true if the fitness kernel can be used on this processor. */
+        static bool
+        IsFitnessKernelSupported(const FitnessKernel kernel);
+        
+        /*! @brief Pack a set of Effort qualities.
+         @param weight The Weight Effort Quality value.
+         @param space The Space Effort Quality value.
+         @param time The Time Effort Quality value.
+         @param flow The Flow Effort Quality value.
+         @returns The packed Effort qualities. */
+        static uint8_t
+        PackEffort(const WeightQuality weight,
+                   const SpaceQuality  space,
+                   const TimeQuality   time,
+                   const FlowQuality   flow);
+        
+        /*! @brief Select the fitness kernel to be used by updateFitness.
+         @param kernel The fitness kernel to be used.
+         @returns @c true if the fitness kernel can be used on this processor and @c false if the
+         selection was not changed. */
+        static bool
+        SetFitnessKernel(const FitnessKernel kernel);
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        PoseBatch(const PoseBatch & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        PoseBatch &
+        operator =(const PoseBatch & other);
+        
+        /*! @brief Set the Effort qualities and Height level of a pose to random values.
+         @param index The index of the pose.
+         @param generator The random number generator to use. */
+        void
+        randomizeQualities(const size_t      index,
+                           RandomGenerator & generator);
+        
+    public :
+        
+        /*! @brief The bits used in the packed Effort qualities. */
+        enum EffortBits
+        {
+            /*! @brief Set for 'Strong' weight, clear for 'Light' weight. */
+            kEffortWeightStrong = 0x01,
+            
+            /*! @brief Set for 'Direct' space, clear for 'Indirect' space. */
+            kEffortSpaceDirect = 0x02,
+            
+            /*! @brief Set for 'Sudden' time, clear for 'Sustained' time. */
+            kEffortTimeSudden = 0x04,
+            
+            /*! @brief Set for 'Bound' flow, clear for 'Free' flow. */
+            kEffortFlowBound = 0x08
+            
+        }; // EffortBits
+        
+        /*! @brief The alignment, in bytes, of each column. */
+        static const size_t kColumnAlignment = 64;
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The columns of angles (in radians). */
+        realType * _angles[Skeleton::kNumCalculatedAngles];
+        
+        /*! @brief The column of calculated fitness scores. */
+        realType * _scores;
+        
+        /*! @brief The column of packed Effort qualities. */
+        uint8_t * _efforts;
+        
+        /*! @brief The column of Height levels. */
+        uint8_t * _heights;
+        
+        /*! @brief The column of marks. */
+        uint8_t * _marks;
+        
+        /*! @brief The storage for all the columns. */
+        void * _storage;
+        
+        /*! @brief The number of poses that can be held without reallocation. */
+        size_t _capacity;
+        
+        /*! @brief The number of poses. */
+        size_t _size;
+        
+    }; // PoseBatch
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_PoseBatch_H_) */
@@ -0,0 +1,192 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePositionedBody.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for PositionedBody objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddlePositionedBody.h"
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for PositionedBody objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The standard initial position of the left side of the hips. */
+static const Coordinate2D kInitialLeftHip(120, 220);
+
+/*! @brief The standard initial position of the left shoulder. */
+static const Coordinate2D kInitialLeftShoulder(110, 100);
+
+/*! @brief The standard initial position of the neck. */
+static const Coordinate2D kInitialNeck(155, 110);
+
+/*! @brief The standard initial position of the right side of the hips. */
+static const Coordinate2D kInitialRightHip(190, 220);
+
+/*! @brief The standard initial position of the right shoulder. */
+static const Coordinate2D kInitialRightShoulder(200, 100);
+
+/*! @brief The standard initial position of the 'tail'. */
+static const Coordinate2D kInitialTail(155, 210);
+
+/*! @brief The maximum amount to perturb a coordinate. */
+static const realType kPerturbation = 5;
+
+/*! @brief The joint radius */
+static const realType kJointRadius = 60;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return a random offset for a joint position.
+ @param generator The random number generator to use.
+ @returns A random offset for a joint position. */
+static Coordinate2D
+generateRandomPerturbation(RandomGenerator & generator)
+{
+    Coordinate2D result(generator.nextReal(- kPerturbation, kPerturbation),
+                        generator.nextReal(- kPerturbation, kPerturbation));
+
+    return result;
+} // generateRandomPerturbation
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PositionedBody::PositionedBody(void) :
+    PositionedBody(kInitialLeftHip, kInitialLeftShoulder, kInitialNeck, kInitialRightHip,
+                   kInitialRightShoulder, kInitialTail, GetThreadRandomGenerator())
+{
+} // PositionedBody::PositionedBody
+
+PositionedBody::PositionedBody(RandomGenerator & generator) :
+    PositionedBody(kInitialLeftHip, kInitialLeftShoulder, kInitialNeck, kInitialRightHip,
+                   kInitialRightShoulder, kInitialTail, generator)
+{
+} // PositionedBody::PositionedBody
+
+PositionedBody::PositionedBody(const Coordinate2D & leftHip,
+                               const Coordinate2D & leftShoulder,
+                               const Coordinate2D & neck,
+                               const Coordinate2D & rightHip,
+                               const Coordinate2D & rightShoulder,
+                               const Coordinate2D & tail,
+                               RandomGenerator &    generator) :
+    inherited(generator), _initLeftHip(leftHip), _initLeftShoulder(leftShoulder),
+    _initRightHip(rightHip), _initRightShoulder(rightShoulder), _neck(neck), _tail(tail)
+{
+    setPositions(generator);
+} // PositionedBody::PositionedBody
+
+PositionedBody::PositionedBody(const PositionedBody & other,
+                               RandomGenerator &      generator) :
+    PositionedBody(other)
+{
+    clearMark();
+    setPositions(generator);
+} // PositionedBody::PositionedBody
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+PositionedBody::mutate(RandomGenerator & generator)
+{
+    inherited::mutate(generator);
+    setPositions(generator);
+} // PositionedBody::mutate
+
+void
+PositionedBody::setPositions(RandomGenerator & generator)
+{
+    _leftElbow = _initLeftShoulder + std::polar(kJointRadius, getLeftShoulderToElbowAngle());
+    _leftWrist = _leftElbow + std::polar(kJointRadius, getLeftElbowToWristAngle());
+    _leftShoulder = _initLeftShoulder + generateRandomPerturbation(generator);
+    _rightElbow = _initRightShoulder + std::polar(kJointRadius, getRightShoulderToElbowAngle());
+    _rightWrist = _rightElbow + std::polar(kJointRadius, getRightElbowToWristAngle());
+    _rightShoulder = _initRightShoulder + generateRandomPerturbation(generator);
+    _leftKnee = _initLeftHip + std::polar(kJointRadius, getLeftHipToKneeAngle());
+    _leftFoot = _leftKnee + std::polar(kJointRadius, getLeftKneeToFootAngle());
+    _leftHip = _initLeftHip + generateRandomPerturbation(generator);
+    _rightKnee = _initRightHip + std::polar(kJointRadius, getRightHipToKneeAngle());
+    _rightFoot = _rightKnee + std::polar(kJointRadius, getRightKneeToFootAngle());
+    _rightHip = _initRightHip + generateRandomPerturbation(generator);
+    realType centre = _leftHip.real() + (std::abs(_rightHip.real() - _leftHip.real()) / 2);
+    
+    _neck.real(centre);
+    _tail.real(centre);
+} // PositionedBody::setPositions
+
+void
+PositionedBody::swapValues(PositionedBody &  other,
+                           const size_t      numSwap,
+                           RandomGenerator & generator)
+{
+    inherited::swapValues(other, numSwap, generator);
+    setPositions(generator);
+    other.setPositions(generator);
+} // PositionedBody::swapValues
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,346 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddlePositionedBody.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for PositionedBody objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_PositionedBody_H_))
+# define Scuddle_PositionedBody_H_ /* Header guard */
+
+# include "ScuddleBody.h"
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for PositionedBody objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief The Scuddle PositionedBody structure, which is a Body that also generates the
+     coordinates of its joints.
+     
+     The joint positions are recalculated from the angles whenever the angles change, so that
+     an Evolver of PositionedBody objects generates positions as well as angles. */
+    class PositionedBody : public Body
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The joints start from the standard positions and the attributes are set using the
+         random number generator for the calling thread. */
+        PositionedBody(void);
+        
+        /*! @brief The constructor.
+         
+         The joints start from the standard positions.
+         @param generator The random number generator used to set the attributes. */
+        explicit
+        PositionedBody(RandomGenerator & generator);
+        
+        /*! @brief The constructor.
+         @param leftHip The initial coordinates of the left side of the hips.
+         @param leftShoulder The initial coordinates of the left shoulder.
+         @param neck The initial coordinates of the neck.
+         @param rightHip The initial coordinates of the right side of the hips.
+         @param rightShoulder The initial coordinates of the right shoulder.
+         @param tail The initial coordinates of the 'tail.
+         @param generator The random number generator used to set the attributes. */
+        PositionedBody(const Coordinate2D & leftHip,
+                       const Coordinate2D & leftShoulder,
+                       const Coordinate2D & neck,
+                       const Coordinate2D & rightHip,
+                       const Coordinate2D & rightShoulder,
+                       const Coordinate2D & tail,
+                       RandomGenerator &    generator);
+        
+        /*! @brief The copy constructor.
+         @param other The PositionedBody to be copied. */
+        PositionedBody(const PositionedBody & other) = default;
+        
+        /*! @brief The move constructor.
+         @param other The PositionedBody to be moved. */
+        PositionedBody(PositionedBody && other) = default;
+        
+        /*! @brief The constructor.
+         
+         The values are copied from another PositionedBody and then the joint positions are
+         perturbed.
+         @param other The PositionedBody to be copied.
+         @param generator The random number generator used to perturb the joint positions. */
+        PositionedBody(const PositionedBody & other,
+                       RandomGenerator &      generator);
+        
+        /*! @brief The destructor. */
+        ~PositionedBody(void) = default;
+        
+        /*! @brief Return the coordinates of the left elbow.
+         @returns The coordinates of the left elbow. */
+        const Coordinate2D &
+        getLeftElbow(void)
+        const
+        {
+            return _leftElbow;
+        } // getLeftElbow
+        
+        /*! @brief Return the coordinates of the left foot.
+         @returns The coordinates of the left foot. */
+        const Coordinate2D &
+        getLeftFoot(void)
+        const
+        {
+            return _leftFoot;
+        } // getLeftFoot
+        
+        /*! @brief Return the coordinates of the left side of the hips.
+         @returns The coordinates of the left side of the hips. */
+        const Coordinate2D &
+        getLeftHip(void)
+        const
+        {
+            return _leftHip;
+        } // getLeftHip
+        
+        /*! @brief Return the coordinates of the left knee.
+         @returns The coordinates of the left knee. */
+        const Coordinate2D &
+        getLeftKnee(void)
+        const
+        {
+            return _leftKnee;
+        } // getLeftKnee
+        
+        /*! @brief Return the coordinates of the left shoulder.
+         @returns The coordinates of the left shoulder. */
+        const Coordinate2D &
+        getLeftShoulder(void)
+        const
+        {
+            return _leftShoulder;
+        } // getLeftShoulder
+        
+        /*! @brief Return the coordinates of the left wrist.
+         @returns The coordinates of the left wrist. */
+        const Coordinate2D &
+        getLeftWrist(void)
+        const
+        {
+            return _leftWrist;
+        } // getLeftWrist
+        
+        /*! @brief Return the coordinates of the neck.
+         @returns The coordinates of the neck. */
+        const Coordinate2D &
+        getNeck(void)
+        const
+        {
+            return _neck;
+        } // getNeck
+        
+        /*! @brief Return the coordinates of the right elbow.
+         @returns The coordinates of the right elbow. */
+        const Coordinate2D &
+        getRightElbow(void)
+        const
+        {
+            return _rightElbow;
+        } // getRightElbow
+        
+        /*! @brief Return the coordinates of the right foot.
+         @returns The coordinates of the right foot. */
+        const Coordinate2D &
+        getRightFoot(void)
+        const
+        {
+            return _rightFoot;
+        } // getRightFoot
+        
+        /*! @brief Return the coordinates of the right side of the hips.
+         @returns The coordinates of the right side of the hips. */
+        const Coordinate2D &
+        getRightHip(void)
+        const
+        {
+            return _rightHip;
+        } // getRightHip
+        
+        /*! @brief Return the coordinates of the right knee.
+         @returns The coordinates of the right knee. */
+        const Coordinate2D &
+        getRightKnee(void)
+        const
+        {
+            return _rightKnee;
+        } // getRightKnee
+        
+        /*! @brief Return the coordinates of the right shoulder.
+         @returns The coordinates of the right shoulder. */
+        const Coordinate2D &
+        getRightShoulder(void)
+        const
+        {
+            return _rightShoulder;
+        } // getRightShoulder
+        
+        /*! @brief Return the coordinates of the right wrist.
+         @returns The coordinates of the right wrist. */
+        const Coordinate2D &
+        getRightWrist(void)
+        const
+        {
+            return _rightWrist;
+        } // getRightWrist
+        
+        /*! @brief Return the coordinates of the 'tail'.
+         @returns The coordinates of the 'tail'. */
+        const Coordinate2D &
+        getTail(void)
+        const
+        {
+            return _tail;
+        } // getTail
+        
+        /*! @brief Mutate a value of the object and update the joint positions.
+         @param generator The random number generator to use. */
+        void
+        mutate(RandomGenerator & generator);
+        
+        /*! @brief The assignment operator.
+         @param other The PositionedBody to be copied.
+         @returns The updated object. */
+        PositionedBody &
+        operator =(const PositionedBody & other) = default;
+        
+        /*! @brief The move assignment operator.
+         @param other The PositionedBody to be moved.
+         @returns The updated object. */
+        PositionedBody &
+        operator =(PositionedBody && other) = default;
+        
+        /*! @brief Choose a set of values and swap with another PositionedBody, then update the
+         joint positions of both.
+         @param other The other PositionedBody to be modified.
+         @param numSwap The number of values to be exchanged.
+         @param generator The random number generator to use. */
+        void
+        swapValues(PositionedBody &  other,
+                   const size_t      numSwap,
+                   RandomGenerator & generator);
+        
+    protected :
+    
+    private :
+        
+        /*! @brief The class that this class is derived from. */
+        typedef Body inherited;
+        
+        /*! @brief Set the joint positions from the angles.
+         @param generator The random number generator used to perturb the joint positions. */
+        void
+        setPositions(RandomGenerator & generator);
+        
+    public :
+    
+    protected :
+    
+    private :
+        
+        /*! @brief The initial position of the left side of the hips. */
+        Coordinate2D _initLeftHip;
+        
+        /*! @brief The initial position of the left shoulder. */
+        Coordinate2D _initLeftShoulder;
+        
+        /*! @brief The initial position of the right side of the hips. */
+        Coordinate2D _initRightHip;
+        
+        /*! @brief The initial position of the right shoulder. */
+        Coordinate2D _initRightShoulder;
+        
+        /*! @brief The position of the left elbow. */
+        Coordinate2D _leftElbow;
+        
+        /*! @brief The position of the left foot. */
+        Coordinate2D _leftFoot;
+        
+        /*! @brief The position of the left side of the hips. */
+        Coordinate2D _leftHip;
+        
+        /*! @brief The position of the left knee. */
+        Coordinate2D _leftKnee;
+        
+        /*! @brief The position of the left shoulder. */
+        Coordinate2D _leftShoulder;
+        
+        /*! @brief The position of the left wrist. */
+        Coordinate2D _leftWrist;
+        
+        /*! @brief The position of the neck. */
+        Coordinate2D _neck;
+        
+        /*! @brief The position of the right elbow. */
+        Coordinate2D _rightElbow;
+        
+        /*! @brief The position of the right foot. */
+        Coordinate2D _rightFoot;
+        
+        /*! @brief The position of the right side of the hips. */
+        Coordinate2D _rightHip;
+        
+        /*! @brief The position of the right knee. */
+        Coordinate2D _rightKnee;
+        
+        /*! @brief The position of the right shoulder. */
+        Coordinate2D _rightShoulder;
+        
+        /*! @brief The position of the right wrist. */
+        Coordinate2D _rightWrist;
+        
+        /*! @brief The position of the 'tail'. */
+        Coordinate2D _tail;
+        
+    }; // PositionedBody
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_PositionedBody_H_) */
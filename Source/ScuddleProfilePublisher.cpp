@@ -0,0 +1,165 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleProfilePublisher.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for publishing fitness coefficients to running engines.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleProfilePublisher.h"
+
+#include <cstring>
+#include <thread>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for publishing fitness coefficients to running engines. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+// The coefficients are copied to and from the published values as a flat array.
+static_assert(0 == (sizeof(FitnessCoefficients) % sizeof(realType)),
+              "FitnessCoefficients objects must only hold realType values");
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ProfilePublisher::ProfilePublisher(void) :
+    _sequence(0)
+{
+    for (size_t ii = 0; kNumValues > ii; ++ii)
+    {
+        _values[ii].store(0, std::memory_order_relaxed);
+    }
+} // ProfilePublisher::ProfilePublisher
+
+ProfilePublisher::~ProfilePublisher(void)
+{
+} // ProfilePublisher::~ProfilePublisher
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+ProfilePublisher::publish(const FitnessProfile & profile)
+{
+    FitnessCoefficients coefficients;
+    realType            values[kNumValues];
+    uint32_t            sequence = _sequence.load(std::memory_order_relaxed);
+    
+    profile.getCoefficients(coefficients);
+    memcpy(values, &coefficients, sizeof(values));
+    // Claim the set by making the sequence number odd; another writer holds it while it is odd.
+    for ( ; ; )
+    {
+        if ((0 == (sequence & 1)) &&
+            _sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+        {
+            break;
+        }
+        
+        std::this_thread::yield();
+        sequence = _sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t ii = 0; kNumValues > ii; ++ii)
+    {
+        _values[ii].store(values[ii], std::memory_order_relaxed);
+    }
+    _sequence.store(sequence + 2, std::memory_order_release);
+} // ProfilePublisher::publish
+
+bool
+ProfilePublisher::update(FitnessProfile & profile,
+                         uint32_t &       version)
+const
+{
+    uint32_t before = _sequence.load(std::memory_order_acquire);
+    bool     copied = false;
+    
+    if ((0 == (before & 1)) && ((before / 2) != version))
+    {
+        realType values[kNumValues];
+        
+        for (size_t ii = 0; kNumValues > ii; ++ii)
+        {
+            values[ii] = _values[ii].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (before == _sequence.load(std::memory_order_relaxed))
+        {
+            FitnessCoefficients coefficients;
+            
+            memcpy(&coefficients, values, sizeof(coefficients));
+            profile.setCoefficients(coefficients);
+            version = (before / 2);
+            copied = true;
+        }
+    }
+    return copied;
+} // ProfilePublisher::update
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
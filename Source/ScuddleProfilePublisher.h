@@ -0,0 +1,141 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleProfilePublisher.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for publishing fitness coefficients to running engines.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_ProfilePublisher_H_))
+# define Scuddle_ProfilePublisher_H_ /* Header guard */
+
+# include "ScuddleFitnessProfile.h"
+
+# include <atomic>
+# include <cstdint>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for publishing fitness coefficients to running engines. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief The most recently published set of fitness coefficients.
+     
+     Any thread can publish a new set of coefficients while engines are running; each engine
+     picks up the new set at its next generation boundary. Readers never lock or wait: the set is
+     guarded by a sequence number, and a reader that finds a set being written keeps the
+     coefficients that it has and tries again at the next boundary. */
+    class ProfilePublisher
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         Nothing is published until publish is called. */
+        ProfilePublisher(void);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~ProfilePublisher(void);
+        
+        /*! @brief Return the number of sets of coefficients that have been published.
+         @returns The number of sets of coefficients that have been published. */
+        uint32_t
+        getVersion(void)
+        const
+        {
+            return (_sequence.load(std::memory_order_acquire) / 2);
+        } // getVersion
+        
+        /*! @brief Publish a new set of coefficients.
+         
+         Writers are serialized with each other, but never wait for readers.
+         @param profile The coefficients to be published. */
+        void
+        publish(const FitnessProfile & profile);
+        
+        /*! @brief Copy the most recently published coefficients, if they are newer than those
+         already held.
+         @param profile Updated with the published coefficients, limited to its ranges.
+         @param version The version of the coefficients held by the caller; updated if the
+         coefficients are copied.
+         @returns @c true if the coefficients were copied and @c false if there was nothing newer
+         or a new set was being written. */
+        bool
+        update(FitnessProfile & profile,
+               uint32_t &       version)
+        const;
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        ProfilePublisher(const ProfilePublisher & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        ProfilePublisher &
+        operator =(const ProfilePublisher & other);
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The number of values in a set of coefficients. */
+        static const size_t kNumValues = (sizeof(FitnessCoefficients) / sizeof(realType));
+        
+        /*! @brief The sequence number of the published set; odd while a set is being written. */
+        std::atomic<uint32_t> _sequence;
+        
+        /*! @brief The published coefficients, in the order of FitnessCoefficients. */
+        std::atomic<realType> _values[kNumValues];
+        
+    }; // ProfilePublisher
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_ProfilePublisher_H_) */
@@ -0,0 +1,293 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleProfileWatcher.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for publishing fitness coefficients from a file.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleProfileWatcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#if (defined(__APPLE__) || defined(__linux__))
+# include <sys/stat.h>
+# include <unistd.h>
+#endif // defined(__APPLE__) || defined(__linux__)
+#if defined(__linux__)
+# include <poll.h>
+# include <sys/inotify.h>
+#endif // defined(__linux__)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for publishing fitness coefficients from a file. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of milliseconds between checks of the file, so that a change takes effect
+ within a video frame. */
+static const int kPollInterval = 10;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__linux__)
+/*! @brief Split a path into the directory that holds it and the name within the directory.
+ @param filePath The path to be split.
+ @param directory Set to the directory that holds the path.
+ @param name Set to the name of the path within the directory. */
+static void
+splitPath(const std::string & filePath,
+          std::string &       directory,
+          std::string &       name)
+{
+    size_t lastSlash = filePath.rfind('/');
+    
+    if (std::string::npos == lastSlash)
+    {
+        directory = ".";
+        name = filePath;
+    }
+    else
+    {
+        directory = ((0 == lastSlash) ? "/" : filePath.substr(0, lastSlash));
+        name = filePath.substr(lastSlash + 1);
+    }
+} // splitPath
+#endif // defined(__linux__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+bool
+ProfileWatcher::ReadProfile(const std::string & filePath,
+                            FitnessProfile &    profile)
+{
+    std::ifstream inFile(filePath.c_str());
+    bool          okSoFar = inFile.is_open();
+    
+    if (okSoFar)
+    {
+        FitnessProfile newProfile;
+        size_t         numValues = 0;
+        std::string    aLine;
+        
+        while (okSoFar && std::getline(inFile, aLine))
+        {
+            std::string text(aLine.substr(0, aLine.find('#')));
+            std::string name;
+            
+            // The '=' is optional, so it is treated as a separator.
+            std::replace(text.begin(), text.end(), '=', ' ');
+            std::istringstream lineStream(text);
+            
+            if (lineStream >> name)
+            {
+                realType newValue;
+                
+                okSoFar = ((lineStream >> newValue) && newProfile.setValue(name, newValue));
+                ++numValues;
+            }
+        }
+        // A file that sets nothing, such as one that has just been created, is not a profile.
+        okSoFar = (okSoFar && (0 < numValues));
+        if (okSoFar)
+        {
+            profile = newProfile;
+        }
+    }
+    return okSoFar;
+} // ProfileWatcher::ReadProfile
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ProfileWatcher::ProfileWatcher(ProfilePublisher &  publisher,
+                               const std::string & filePath) :
+    _publisher(publisher), _filePath(filePath), _notifyFd(-1), _stopping(false)
+{
+    reload();
+#if defined(__linux__)
+    std::string directory;
+    std::string name;
+    
+    splitPath(_filePath, directory, name);
+    _notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (0 <= _notifyFd)
+    {
+        // The directory is watched, as editors often save a file by replacing it; a file is only
+        // read once it has been completely written or moved into place.
+        if (0 > inotify_add_watch(_notifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO))
+        {
+            close(_notifyFd);
+            _notifyFd = -1;
+        }
+    }
+#endif // defined(__linux__)
+#if (defined(__APPLE__) || defined(__linux__))
+    _thread = std::thread(&ProfileWatcher::watchLoop, this);
+#endif // defined(__APPLE__) || defined(__linux__)
+} // ProfileWatcher::ProfileWatcher
+
+ProfileWatcher::~ProfileWatcher(void)
+{
+    _stopping = true;
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+#if (defined(__APPLE__) || defined(__linux__))
+    if (0 <= _notifyFd)
+    {
+        close(_notifyFd);
+    }
+#endif // defined(__APPLE__) || defined(__linux__)
+} // ProfileWatcher::~ProfileWatcher
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+ProfileWatcher::reload(void)
+{
+    FitnessProfile newProfile;
+    
+    if (ReadProfile(_filePath, newProfile))
+    {
+        _publisher.publish(newProfile);
+    }
+} // ProfileWatcher::reload
+
+void
+ProfileWatcher::watchLoop(void)
+{
+#if (defined(__APPLE__) || defined(__linux__))
+    struct stat fileStatus;
+    time_t      lastModified = 0;
+    off_t       lastSize = 0;
+# if defined(__linux__)
+    std::string directory;
+    std::string name;
+    
+    splitPath(_filePath, directory, name);
+# endif // defined(__linux__)
+    
+    if (0 == stat(_filePath.c_str(), &fileStatus))
+    {
+        lastModified = fileStatus.st_mtime;
+        lastSize = fileStatus.st_size;
+    }
+    while (! _stopping)
+    {
+        bool changed = false;
+        
+# if defined(__linux__)
+        if (0 <= _notifyFd)
+        {
+            struct pollfd notifyPoll = { _notifyFd, POLLIN, 0 };
+            
+            if ((0 < poll(&notifyPoll, 1, kPollInterval)) && (notifyPoll.revents & POLLIN))
+            {
+                alignas(struct inotify_event) char buffer[4096];
+                ssize_t                            numBytes;
+                
+                while (0 < (numBytes = read(_notifyFd, buffer, sizeof(buffer))))
+                {
+                    for (ssize_t offset = 0; numBytes > offset; )
+                    {
+                        const struct inotify_event * anEvent =
+                                        reinterpret_cast<const struct inotify_event *>(buffer +
+                                                                                       offset);
+                        
+                        if ((0 < anEvent->len) && (name == anEvent->name))
+                        {
+                            changed = true;
+                        }
+                        offset += static_cast<ssize_t>(sizeof(struct inotify_event) +
+                                                       anEvent->len);
+                    }
+                }
+            }
+        }
+        else
+# endif // defined(__linux__)
+        {
+            // The modification time has a resolution of a second, so the size is also checked.
+            std::this_thread::sleep_for(std::chrono::milliseconds(kPollInterval));
+            if (0 == stat(_filePath.c_str(), &fileStatus))
+            {
+                changed = ((lastModified != fileStatus.st_mtime) ||
+                           (lastSize != fileStatus.st_size));
+                lastModified = fileStatus.st_mtime;
+                lastSize = fileStatus.st_size;
+            }
+        }
+        if (changed)
+        {
+            reload();
+        }
+    }
+#endif // defined(__APPLE__) || defined(__linux__)
+} // ProfileWatcher::watchLoop
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
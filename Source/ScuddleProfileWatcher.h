@@ -0,0 +1,155 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleProfileWatcher.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for publishing fitness coefficients from a file.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_ProfileWatcher_H_))
+# define Scuddle_ProfileWatcher_H_ /* Header guard */
+
+# include "ScuddleProfilePublisher.h"
+
+# include <atomic>
+# include <string>
+# include <thread>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for publishing fitness coefficients from a file. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief Publishes the fitness coefficients held in a file, each time the file changes.
+     
+     The file holds one coefficient per line, as a name followed by an optional '=' and a value,
+     such as 'effortHigh = 1.4'; the names are those of the members of FitnessProfile. Text after
+     a '#' is ignored, and coefficients that are not mentioned keep their initial values. A file
+     that cannot be read completely is not published, so that a partly saved file does not
+     disturb the engines.
+     
+     On Linux the file is watched with inotify; elsewhere its modification time is checked at a
+     short interval. */
+    class ProfileWatcher
+    {
+    public :
+        
+        /*! @brief The constructor.
+         
+         The file is read and published before the constructor returns, if it can be read.
+         @param publisher The publisher for the coefficients.
+         @param filePath The path to the file that holds the coefficients. */
+        ProfileWatcher(ProfilePublisher &  publisher,
+                       const std::string & filePath);
+        
+        /*! @brief The destructor.
+         
+         The file is no longer watched. */
+        virtual
+        ~ProfileWatcher(void);
+        
+        /*! @brief Return @c true if the file is being watched.
+         @returns @c true if the file is being watched and @c false if it was only read once. */
+        bool
+        isWatching(void)
+        const
+        {
+            return _thread.joinable();
+        } // isWatching
+        
+        /*! @brief Read a set of coefficients from a file.
+         @param filePath The path to the file that holds the coefficients.
+         @param profile Set to the coefficients in the file, if it was read.
+         @returns @c true if the file was read completely and set at least one coefficient and
+         @c false otherwise. */
+        static bool
+        ReadProfile(const std::string & filePath,
+                    FitnessProfile &    profile);
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        ProfileWatcher(const ProfileWatcher & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        ProfileWatcher &
+        operator =(const ProfileWatcher & other);
+        
+        /*! @brief Read the file and publish its coefficients, if it can be read. */
+        void
+        reload(void);
+        
+        /*! @brief The body of the thread that watches the file. */
+        void
+        watchLoop(void);
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The publisher for the coefficients. */
+        ProfilePublisher & _publisher;
+        
+        /*! @brief The path to the file that holds the coefficients. */
+        std::string _filePath;
+        
+        /*! @brief The thread that watches the file. */
+        std::thread _thread;
+        
+        /*! @brief The inotify descriptor, or @c -1 if the modification time is checked instead. */
+        int _notifyFd;
+        
+        /*! @brief @c true if the thread is to exit. */
+        std::atomic<bool> _stopping;
+        
+    }; // ProfileWatcher
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_ProfileWatcher_H_) */
@@ -0,0 +1,269 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleQuantileSketch.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for QuantileSketch objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleQuantileSketch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for QuantileSketch objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of values that are buffered for each unit of the compression factor. */
+static const size_t kBufferFactor = 5;
+
+/*! @brief The value of PI. */
+static const double kPi = 3.14159265358979323846;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the quantile corresponding to a position on the scale.
+ 
+ This is the inverse of scaleForQuantile.
+ @param scale The position on the scale.
+ @param compression The compression factor.
+ @returns The quantile corresponding to the position on the scale. */
+static double
+quantileForScale(const double scale,
+                 const double compression)
+{
+    double angle = (scale * 2 * kPi / compression);
+    
+    return ((angle >= (kPi / 2)) ? 1 : ((std::sin(angle) + 1) / 2));
+} // quantileForScale
+
+/*! @brief Return the position on the scale of a quantile.
+ 
+ The scale is steep near the ends of the distribution and flat in the middle; a centroid may
+ only cover one unit of the scale, so the centroids are small near the ends.
+ @param fraction The quantile.
+ @param compression The compression factor.
+ @returns The position on the scale of the quantile. */
+static double
+scaleForQuantile(const double fraction,
+                 const double compression)
+{
+    return (compression * std::asin((2 * std::min(1.0, std::max(0.0, fraction))) - 1) /
+            (2 * kPi));
+} // scaleForQuantile
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+QuantileSketch::QuantileSketch(const size_t compression) :
+    _compression(static_cast<double>(std::max(compression, static_cast<size_t>(1)))),
+    _maximum(0), _minimum(0),
+    _bufferCapacity(kBufferFactor * std::max(compression, static_cast<size_t>(1))), _count(0)
+{
+    // All the storage is set aside now, so that adding values does not allocate memory.
+    _buffer.reserve(_bufferCapacity);
+    _centroids.reserve(static_cast<size_t>(_compression) + 2);
+    _merged.reserve(static_cast<size_t>(_compression) + 2);
+} // QuantileSketch::QuantileSketch
+
+QuantileSketch::~QuantileSketch(void)
+{
+} // QuantileSketch::~QuantileSketch
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+QuantileSketch::compress(void)
+{
+    if (! _buffer.empty())
+    {
+        size_t   numOld = _centroids.size();
+        size_t   numNew = _buffer.size();
+        size_t   oldIndex = 0;
+        size_t   newIndex = 0;
+        double   totalWeight = static_cast<double>(_count + numNew);
+        double   weightSoFar = 0;
+        double   weightLimit = 0;
+        Centroid current;
+        
+        std::sort(_buffer.begin(), _buffer.end(), [] (const Centroid & first,
+                                                      const Centroid & second)
+                  {
+                      return (first._mean < second._mean);
+                  });
+        if (_count)
+        {
+            _minimum = std::min(_minimum, _buffer.front()._mean);
+            _maximum = std::max(_maximum, _buffer.back()._mean);
+        }
+        else
+        {
+            _minimum = _buffer.front()._mean;
+            _maximum = _buffer.back()._mean;
+        }
+        // Walk the old centroids and the new values in order, combining neighbours while the
+        // combination stays within one unit of the scale.
+        _merged.clear();
+        for (size_t ii = 0, imax = (numOld + numNew); imax > ii; ++ii)
+        {
+            bool             takeOld = ((numOld > oldIndex) &&
+                                        ((numNew <= newIndex) ||
+                                         (_centroids[oldIndex]._mean <= _buffer[newIndex]._mean)));
+            const Centroid & next = (takeOld ? _centroids[oldIndex++] : _buffer[newIndex++]);
+            
+            if (0 == ii)
+            {
+                current = next;
+                weightLimit = (totalWeight * quantileForScale(scaleForQuantile(0, _compression) +
+                                                              1, _compression));
+            }
+            else if ((weightSoFar + current._weight + next._weight) <= weightLimit)
+            {
+                current._weight += next._weight;
+                current._mean += ((next._mean - current._mean) * next._weight / current._weight);
+            }
+            else
+            {
+                weightSoFar += current._weight;
+                _merged.push_back(current);
+                current = next;
+                weightLimit = (totalWeight *
+                               quantileForScale(scaleForQuantile(weightSoFar / totalWeight,
+                                                                 _compression) + 1,
+                                                _compression));
+            }
+        }
+        _merged.push_back(current);
+        _centroids.swap(_merged);
+        _buffer.clear();
+        _count += numNew;
+    }
+} // QuantileSketch::compress
+
+double
+QuantileSketch::getQuantile(const double fraction)
+const
+{
+    double result = 0;
+    
+    if (1 == _centroids.size())
+    {
+        result = _centroids.front()._mean;
+    }
+    else if (! _centroids.empty())
+    {
+        const Centroid & first = _centroids.front();
+        const Centroid & last = _centroids.back();
+        double           position = (std::min(1.0, std::max(0.0, fraction)) * _count);
+        double           lastStart = (_count - (last._weight / 2));
+        
+        // Each centroid is taken to be centred on its mean, with the smallest and largest values
+        // at the ends; positions in between are interpolated.
+        if (position < (first._weight / 2))
+        {
+            result = (_minimum + ((first._mean - _minimum) * position / (first._weight / 2)));
+        }
+        else if (position > lastStart)
+        {
+            result = (last._mean + ((_maximum - last._mean) * (position - lastStart) /
+                                    (last._weight / 2)));
+        }
+        else
+        {
+            bool   found = false;
+            double weightSoFar = (first._weight / 2);
+            
+            result = last._mean;
+            for (size_t ii = 1, imax = _centroids.size(); (! found) && (imax > ii); ++ii)
+            {
+                const Centroid & before = _centroids[ii - 1];
+                const Centroid & after = _centroids[ii];
+                double           step = ((before._weight + after._weight) / 2);
+                
+                if ((weightSoFar + step) >= position)
+                {
+                    result = (before._mean + ((after._mean - before._mean) *
+                                              (position - weightSoFar) / step));
+                    found = true;
+                }
+                else
+                {
+                    weightSoFar += step;
+                }
+            }
+        }
+    }
+    return result;
+} // QuantileSketch::getQuantile
+
+void
+QuantileSketch::reset(void)
+{
+    _buffer.clear();
+    _centroids.clear();
+    _maximum = 0;
+    _minimum = 0;
+    _count = 0;
+} // QuantileSketch::reset
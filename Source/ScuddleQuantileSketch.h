@@ -0,0 +1,190 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleQuantileSketch.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for QuantileSketch objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_QuantileSketch_H_))
+# define Scuddle_QuantileSketch_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+
+# include <cstdint>
+# include <vector>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for QuantileSketch objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief An estimator of the quantiles of a stream of values, using bounded memory.
+     
+     This is a merging t-digest: the values are summarized by weighted centroids, which are kept
+     small near the ends of the distribution and allowed to grow in the middle, so that the
+     extreme quantiles stay accurate. New values are gathered in a buffer and merged into the
+     centroids when it fills, so the storage is fixed when the sketch is constructed and adding a
+     value does not allocate memory. */
+    class QuantileSketch
+    {
+    public :
+        
+        /*! @brief The constructor.
+         @param compression The compression factor; the number of centroids never exceeds one
+         more than this, and larger values give more accurate quantiles. */
+        explicit
+        QuantileSketch(const size_t compression = kDefaultCompression);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~QuantileSketch(void);
+        
+        /*! @brief Add a value to the sketch.
+         @param value The value to be added. */
+        void
+        add(const double value)
+        {
+            Centroid aCentroid;
+            
+            aCentroid._mean = value;
+            aCentroid._weight = 1;
+            _buffer.push_back(aCentroid);
+            if (_buffer.size() >= _bufferCapacity)
+            {
+                compress();
+            }
+        } // add
+        
+        /*! @brief Merge the buffered values into the centroids.
+         
+         The quantiles only cover the values that have been merged, so this should be called
+         after the last value is added. */
+        void
+        compress(void);
+        
+        /*! @brief Return the number of values that have been merged into the centroids.
+         @returns The number of values that have been merged into the centroids. */
+        uint64_t
+        getCount(void)
+        const
+        {
+            return _count;
+        } // getCount
+        
+        /*! @brief Return the estimated value at a quantile of the merged values.
+         @param fraction The quantile, from @c 0 (the smallest value) to @c 1 (the largest).
+         @returns The estimated value at the quantile, or @c 0 if no values have been merged. */
+        double
+        getQuantile(const double fraction)
+        const;
+        
+        /*! @brief Discard all the values. */
+        void
+        reset(void);
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        QuantileSketch(const QuantileSketch & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        QuantileSketch &
+        operator =(const QuantileSketch & other);
+        
+        /*! @brief A set of values that are summarized by their mean. */
+        struct Centroid
+        {
+            /*! @brief The mean of the values. */
+            double _mean;
+            
+            /*! @brief The number of values. */
+            double _weight;
+            
+        }; // Centroid
+        
+        /*! @brief A sequence of centroids. */
+        typedef std::vector<Centroid> CentroidVector;
+        
+    public :
+        
+        /*! @brief The default compression factor. */
+        static const size_t kDefaultCompression = 100;
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The values that have not yet been merged into the centroids. */
+        CentroidVector _buffer;
+        
+        /*! @brief The centroids, in increasing order of their means. */
+        CentroidVector _centroids;
+        
+        /*! @brief The storage for the new centroids while a merge is in progress. */
+        CentroidVector _merged;
+        
+        /*! @brief The compression factor. */
+        double _compression;
+        
+        /*! @brief The largest merged value. */
+        double _maximum;
+        
+        /*! @brief The smallest merged value. */
+        double _minimum;
+        
+        /*! @brief The number of values that are buffered before they are merged. */
+        size_t _bufferCapacity;
+        
+        /*! @brief The number of values that have been merged into the centroids. */
+        uint64_t _count;
+        
+    }; // QuantileSketch
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_QuantileSketch_H_) */
@@ -0,0 +1,372 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleRandomGenerator.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for RandomGenerator objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleRandomGenerator.h"
+
+#include "ScuddleCommon.h"
+
+#include <atomic>
+#include <random>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for RandomGenerator objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The per-thread random number generator and the seed generation that it was made from. */
+struct ThreadGenerator
+{
+    /*! @brief The random number generator. */
+    RandomGenerator generator;
+    
+    /*! @brief The stream number of the generator. */
+    uint64_t stream;
+    
+    /*! @brief The value of lSeedGeneration when the generator was seeded. */
+    uint32_t seedGeneration;
+    
+    /*! @brief @c true if the generator has been seeded. */
+    bool seeded;
+    
+}; // ThreadGenerator
+
+/*! @brief The number of interleaved generators used by the bulk fill operations. */
+static const size_t kNumLanes = 8;
+
+/*! @brief The scale for converting 24 random bits to a number in the range 0..1, excluding 1. */
+static const realType kFloatScale = static_cast<realType>(1.0 / 16777216.0);
+
+/*! @brief The seed for the per-thread random number generators. */
+static std::atomic<uint64_t> lThreadSeed(0);
+
+/*! @brief The stream number for the next thread to ask for its random number generator. */
+static std::atomic<uint64_t> lNextThreadStream(0);
+
+/*! @brief The number of times that SeedRandomNumbers has been called. */
+static std::atomic<uint32_t> lSeedGeneration(0);
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return a seed from the system entropy source.
+ @returns A seed from the system entropy source. */
+static uint64_t
+entropySeed(void)
+{
+    std::random_device source;
+    uint64_t           result = source();
+    
+    return ((result << 32) ^ source());
+} // entropySeed
+
+/*! @brief Advance a splitmix64 state and return the next output.
+ @param state The state to be advanced.
+ @returns The next output. */
+static inline uint64_t
+splitMix(uint64_t & state)
+{
+    uint64_t result = (state += 0x9E3779B97F4A7C15);
+    
+    result = ((result ^ (result >> 30)) * 0xBF58476D1CE4E5B9);
+    result = ((result ^ (result >> 27)) * 0x94D049BB133111EB);
+    return (result ^ (result >> 31));
+} // splitMix
+
+/*! @brief Convert 24 random bits to a number in the range lowValue..highValue.
+ @param bits The random bits, in the low 24 bits.
+ @param lowValue The lower bound for the output.
+ @param range The difference between the upper and lower bounds.
+ @returns The converted value. */
+static inline realType
+bitsToReal(const uint64_t bits,
+           const realType lowValue,
+           const realType range)
+{
+    return (lowValue + ((static_cast<realType>(bits & 0x00FFFFFF) * kFloatScale) * range));
+} // bitsToReal
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+RandomGenerator::RandomGenerator(void)
+{
+    setState(entropySeed());
+} // RandomGenerator::RandomGenerator
+
+RandomGenerator::RandomGenerator(const uint64_t seed)
+{
+    setState(seed);
+} // RandomGenerator::RandomGenerator
+
+RandomGenerator::RandomGenerator(const uint64_t seed,
+                                 const uint64_t stream)
+{
+    // Hash the stream number separately, so that nearby seeds and streams do not collide.
+    uint64_t streamState = ~stream;
+    
+    setState(seed ^ splitMix(streamState));
+} // RandomGenerator::RandomGenerator
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+RandomGenerator::fillAngles(realType *     angles,
+                            const size_t   count,
+                            const realType maxAngle)
+{
+    fillReals(angles, count, 0, DegreesToRadians(maxAngle));
+} // RandomGenerator::fillAngles
+
+void
+RandomGenerator::fillReals(realType *     values,
+                           const size_t   count,
+                           const realType lowValue,
+                           const realType highValue)
+{
+    realType range = (highValue - lowValue);
+    size_t   ii = 0;
+    
+    if ((2 * kNumLanes) <= count)
+    {
+        // Independent interleaved generators, seeded from this one, laid out so that each step
+        // of all the lanes is a straight-line loop over arrays.
+        uint64_t state0[kNumLanes];
+        uint64_t state1[kNumLanes];
+        uint64_t state2[kNumLanes];
+        uint64_t state3[kNumLanes];
+        uint64_t output[kNumLanes];
+        
+        for (size_t lane = 0; kNumLanes > lane; ++lane)
+        {
+            uint64_t seedState = next();
+            
+            state0[lane] = splitMix(seedState);
+            state1[lane] = splitMix(seedState);
+            state2[lane] = splitMix(seedState);
+            state3[lane] = splitMix(seedState);
+        }
+        for ( ; count >= (ii + (2 * kNumLanes)); ii += (2 * kNumLanes))
+        {
+            for (size_t lane = 0; kNumLanes > lane; ++lane)
+            {
+                uint64_t shifted = (state1[lane] << 17);
+                
+                output[lane] = rotateLeft(state1[lane] * 5, 7) * 9;
+                state2[lane] ^= state0[lane];
+                state3[lane] ^= state1[lane];
+                state1[lane] ^= state2[lane];
+                state0[lane] ^= state3[lane];
+                state2[lane] ^= shifted;
+                state3[lane] = rotateLeft(state3[lane], 45);
+            }
+            // Each raw value supplies two values, from its top and middle 24 bits.
+            for (size_t lane = 0; kNumLanes > lane; ++lane)
+            {
+                values[ii + lane] = bitsToReal(output[lane] >> 40, lowValue, range);
+                values[ii + kNumLanes + lane] = bitsToReal(output[lane] >> 16, lowValue, range);
+            }
+        }
+    }
+    for ( ; count > ii; ++ii)
+    {
+        values[ii] = bitsToReal(next() >> 40, lowValue, range);
+    }
+} // RandomGenerator::fillReals
+
+void
+RandomGenerator::jump(void)
+{
+    static const uint64_t kJump[] =
+    {
+        0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C
+    };
+    uint64_t newState[4] = { 0, 0, 0, 0 };
+    
+    for (size_t ii = 0; (sizeof(kJump) / sizeof(*kJump)) > ii; ++ii)
+    {
+        for (int bit = 0; 64 > bit; ++bit)
+        {
+            if (kJump[ii] & (static_cast<uint64_t>(1) << bit))
+            {
+                for (size_t jj = 0; 4 > jj; ++jj)
+                {
+                    newState[jj] ^= _state[jj];
+                }
+            }
+            next();
+        }
+    }
+    for (size_t jj = 0; 4 > jj; ++jj)
+    {
+        _state[jj] = newState[jj];
+    }
+} // RandomGenerator::jump
+
+realType
+RandomGenerator::nextAngle(const realType maxAngle)
+{
+    return DegreesToRadians(nextReal(0, maxAngle));
+} // RandomGenerator::nextAngle
+
+realType
+RandomGenerator::nextReal(const realType lowValue,
+                          const realType highValue)
+{
+    return bitsToReal(next() >> 40, lowValue, highValue - lowValue);
+} // RandomGenerator::nextReal
+
+size_t
+RandomGenerator::nextUnsigned(const size_t highValue)
+{
+    uint64_t bound = static_cast<uint64_t>(highValue) + 1;
+    uint64_t result;
+    
+    if (0 == bound)
+    {
+        // The full range of 64 bits was requested.
+        result = next();
+    }
+    else
+    {
+#if defined(__SIZEOF_INT128__)
+        // Lemire's multiply-and-reject method, which needs a division only when rejecting.
+        unsigned __int128 product = static_cast<unsigned __int128>(next()) * bound;
+        uint64_t          low = static_cast<uint64_t>(product);
+        
+        if (low < bound)
+        {
+            uint64_t threshold = ((0 - bound) % bound);
+            
+            for ( ; low < threshold; )
+            {
+                product = static_cast<unsigned __int128>(next()) * bound;
+                low = static_cast<uint64_t>(product);
+            }
+        }
+        result = static_cast<uint64_t>(product >> 64);
+#else // ! defined(__SIZEOF_INT128__)
+        // Reject the values that would make the remainders unevenly distributed.
+        uint64_t threshold = ((0 - bound) % bound);
+        uint64_t value;
+        
+        for (value = next(); value < threshold; value = next())
+        {
+        }
+        result = (value % bound);
+#endif // ! defined(__SIZEOF_INT128__)
+    }
+    return static_cast<size_t>(result);
+} // RandomGenerator::nextUnsigned
+
+void
+RandomGenerator::setState(const uint64_t seed)
+{
+    uint64_t seedState = seed;
+    
+    for (size_t ii = 0; 4 > ii; ++ii)
+    {
+        _state[ii] = splitMix(seedState);
+    }
+} // RandomGenerator::setState
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+RandomGenerator &
+Scuddle::GetThreadRandomGenerator(void)
+{
+    static thread_local ThreadGenerator threadGenerator = { RandomGenerator(0), 0, 0, false };
+    uint32_t                            seedGeneration = lSeedGeneration.load();
+    
+    if ((! threadGenerator.seeded) || (threadGenerator.seedGeneration != seedGeneration))
+    {
+        if (! threadGenerator.seeded)
+        {
+            threadGenerator.stream = lNextThreadStream++;
+            threadGenerator.seeded = true;
+        }
+        threadGenerator.seedGeneration = seedGeneration;
+        if (0 == seedGeneration)
+        {
+            threadGenerator.generator = RandomGenerator(entropySeed(), threadGenerator.stream);
+        }
+        else
+        {
+            threadGenerator.generator = RandomGenerator(lThreadSeed.load(),
+                                                        threadGenerator.stream);
+        }
+    }
+    return threadGenerator.generator;
+} // Scuddle::GetThreadRandomGenerator
+
+void
+Scuddle::SeedRandomNumbers(const uint64_t seed)
+{
+    lThreadSeed = seed;
+    ++lSeedGeneration;
+} // Scuddle::SeedRandomNumbers
@@ -0,0 +1,245 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleRandomGenerator.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for RandomGenerator objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_RandomGenerator_H_))
+# define Scuddle_RandomGenerator_H_ /* Header guard */
+
+# include "ScuddleDataTypes.h"
+
+# include <cstdint>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for RandomGenerator objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief A xoshiro256** pseudo-random number generator.
+     
+     The state is seeded through splitmix64, so that any seed, including zero, gives a usable
+     state. A seed and a stream number together select an independent sequence, which allows
+     each thread or each object to have its own sequence that does not depend on how the work is
+     divided up. The class meets the requirements of a uniform random bit generator, so it can
+     also be used with the standard distributions. */
+    class RandomGenerator
+    {
+    public :
+        
+        /*! @brief The type of the raw values that are produced. */
+        typedef uint64_t result_type;
+        
+        /*! @brief The constructor.
+         
+         The generator is seeded from the system entropy source. */
+        RandomGenerator(void);
+        
+        /*! @brief The constructor.
+         @param seed The seed for the generator. */
+        explicit
+        RandomGenerator(const uint64_t seed);
+        
+        /*! @brief The constructor.
+         @param seed The seed for the generator.
+         @param stream The stream number, which selects an independent sequence for the seed. */
+        RandomGenerator(const uint64_t seed,
+                        const uint64_t stream);
+        
+        /*! @brief Fill an array with uniformly distributed random angles in the range
+         0..maxAngle, as radians.
+         
+         The generator state is interleaved across several lanes, so that the compiler can
+         produce vector code for large arrays.
+         @param angles The array to be filled.
+         @param count The number of angles to produce.
+         @param maxAngle The upper bound for the output, in degrees. */
+        void
+        fillAngles(realType *     angles,
+                   const size_t   count,
+                   const realType maxAngle);
+        
+        /*! @brief Fill an array with uniformly distributed random numbers in the range
+         lowValue..highValue.
+         @param values The array to be filled.
+         @param count The number of values to produce.
+         @param lowValue The lower bound for the output.
+         @param highValue The upper bound for the output. */
+        void
+        fillReals(realType *     values,
+                  const size_t   count,
+                  const realType lowValue,
+                  const realType highValue);
+        
+        /*! @brief Advance the generator by 2^128 steps.
+         
+         This gives a sequence that cannot overlap the original one for 2^128 values. */
+        void
+        jump(void);
+        
+        /*! @brief Return the largest raw value that can be produced.
+         @returns The largest raw value that can be produced. */
+        static constexpr result_type
+        max(void)
+        {
+            return UINT64_MAX;
+        } // max
+        
+        /*! @brief Return the smallest raw value that can be produced.
+         @returns The smallest raw value that can be produced. */
+        static constexpr result_type
+        min(void)
+        {
+            return 0;
+        } // min
+        
+        /*! @brief Return the next raw value.
+         @returns The next raw value. */
+        uint64_t
+        next(void)
+        {
+            uint64_t result = rotateLeft(_state[1] * 5, 7) * 9;
+            uint64_t shifted = (_state[1] << 17);
+            
+            _state[2] ^= _state[0];
+            _state[3] ^= _state[1];
+            _state[1] ^= _state[2];
+            _state[0] ^= _state[3];
+            _state[2] ^= shifted;
+            _state[3] = rotateLeft(_state[3], 45);
+            return result;
+        } // next
+        
+        /*! @brief Return a uniformly distributed random angle in the range 0..maxAngle, as
+         radians.
+         @param maxAngle The upper bound for the output, in degrees.
+         @returns A uniformly distributed random angle in the range 0..maxAngle. */
+        realType
+        nextAngle(const realType maxAngle);
+        
+        /*! @brief Return a uniformly distributed random number in the range 0..1, excluding 1.
+         @returns A uniformly distributed random number in the range 0..1, excluding 1. */
+        double
+        nextDouble(void)
+        {
+            // The top 53 bits fill the mantissa of a double exactly.
+            return (static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0));
+        } // nextDouble
+        
+        /*! @brief Return a uniformly distributed random number in the range lowValue..highValue.
+         @param lowValue The lower bound for the output.
+         @param highValue The upper bound for the output.
+         @returns A uniformly distributed random number in the range lowValue..highValue. */
+        realType
+        nextReal(const realType lowValue,
+                 const realType highValue);
+        
+        /*! @brief Return a uniformly distributed random number in the range 0..highValue.
+         
+         Every value in the range is equally likely; there is no modulo bias.
+         @param highValue The upper bound for the output.
+         @returns A uniformly distributed random number in the range 0..highValue. */
+        size_t
+        nextUnsigned(const size_t highValue);
+        
+        /*! @brief Return the next raw value.
+         @returns The next raw value. */
+        result_type
+        operator ()(void)
+        {
+            return next();
+        } // operator ()
+        
+    protected :
+        
+    private :
+        
+        /*! @brief Return a value rotated to the left.
+         @param value The value to be rotated.
+         @param count The number of bits to rotate by.
+         @returns The rotated value. */
+        static inline uint64_t
+        rotateLeft(const uint64_t value,
+                   const int      count)
+        {
+            return ((value << count) | (value >> (64 - count)));
+        } // rotateLeft
+        
+        /*! @brief Set the state from a seed.
+         @param seed The seed for the generator. */
+        void
+        setState(const uint64_t seed);
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The state of the generator. */
+        uint64_t _state[4];
+        
+    }; // RandomGenerator
+    
+    /*! @brief Return the random number generator for the calling thread.
+     
+     Each thread has its own generator, so this can be used from several threads at the same time.
+     The generators are seeded from the value given to SeedRandomNumbers, with the stream number
+     set by the order in which the threads first ask for their generator; if SeedRandomNumbers has
+     not been called, they are seeded from the system entropy source.
+     @returns The random number generator for the calling thread. */
+    RandomGenerator &
+    GetThreadRandomGenerator(void);
+    
+    /*! @brief Set the seed for the per-thread random number generators.
+     
+     Each thread's generator is reseeded the next time that it is requested.
+     @param seed The seed for the per-thread random number generators. */
+    void
+    SeedRandomNumbers(const uint64_t seed);
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_RandomGenerator_H_) */
@@ -0,0 +1,242 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleRouletteWheel.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for RouletteWheel objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleRouletteWheel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for RouletteWheel objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+RouletteWheel::RouletteWheel(void) :
+    _total(0)
+{
+} // RouletteWheel::RouletteWheel
+
+RouletteWheel::~RouletteWheel(void)
+{
+} // RouletteWheel::~RouletteWheel
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+RouletteWheel::build(const realType * weights,
+                     const size_t     numWeights)
+{
+    double sum = 0;
+    double compensation = 0;
+    
+    _weights.resize(numWeights);
+    _cumulative.resize(numWeights);
+    for (size_t ii = 0; numWeights > ii; ++ii)
+    {
+        realType weight = ((0 < weights[ii]) ? weights[ii] : 0);
+        
+        _weights[ii] = weight;
+        if (0 < weight)
+        {
+            // Kahan summation - 'compensation' holds the low-order bits lost by the last addition.
+            double adjusted = (weight - compensation);
+            double newSum = (sum + adjusted);
+            
+            compensation = ((newSum - sum) - adjusted);
+            // The compensation must not make the totals go backwards, or the search will fail.
+            sum = std::max(sum, newSum);
+        }
+        _cumulative[ii] = sum;
+    }
+    _total = sum;
+} // RouletteWheel::build
+
+size_t
+RouletteWheel::find(const double position)
+const
+{
+    // The first object whose running total is beyond the position; objects with a weight of zero
+    // have the same running total as the object before them, and so are never found.
+    size_t result = static_cast<size_t>(std::upper_bound(_cumulative.begin(), _cumulative.end(),
+                                                         position) - _cumulative.begin());
+    
+    if (_cumulative.size() <= result)
+    {
+        // Only possible through rounding, with the position at the very end of the wheel.
+        result = _cumulative.size() - 1;
+        for ( ; (0 < result) && (0 >= _weights[result]); --result)
+        {
+        }
+    }
+    return result;
+} // RouletteWheel::find
+
+size_t
+RouletteWheel::pick(RandomGenerator & generator)
+const
+{
+    return find(generator.nextDouble() * _total);
+} // RouletteWheel::pick
+
+void
+RouletteWheel::pickUniversal(const size_t          count,
+                             RandomGenerator &     generator,
+                             std::vector<size_t> & result)
+const
+{
+    result.clear();
+    if ((0 < count) && (0 < _total))
+    {
+        double spacing = (_total / count);
+        double start = (generator.nextDouble() * spacing);
+        size_t index = 0;
+        
+        result.reserve(count);
+        for (size_t ii = 0; count > ii; ++ii)
+        {
+            double position = (start + (ii * spacing));
+            
+            // The pointers are in ascending order, so the search can carry on from the last one.
+            for ( ; (_cumulative.size() > index) && (_cumulative[index] <= position); ++index)
+            {
+            }
+            if (_cumulative.size() > index)
+            {
+                result.push_back(index);
+            }
+            else
+            {
+                result.push_back(find(position));
+            }
+        }
+    }
+} // RouletteWheel::pickUniversal
+
+void
+RouletteWheel::pickWithoutReplacement(const size_t          count,
+                                      RandomGenerator &     generator,
+                                      std::vector<size_t> & result)
+{
+    size_t numChosen = std::min(count, _weights.size());
+    
+    result.clear();
+    if (0 < numChosen)
+    {
+        // Efraimidis-Spirakis: the key for an object is u^(1/weight), for a uniform u in 0..1;
+        // the logarithm of the key is used, as it has the same ordering and does not underflow.
+        // Keep the objects with the largest keys in a heap whose top is the smallest kept key.
+        std::greater<KeyedIndex> keyOrder;
+        
+        _keys.clear();
+        for (size_t ii = 0, imax = _weights.size(); imax > ii; ++ii)
+        {
+            realType weight = _weights[ii];
+            double   key;
+            
+            if (0 < weight)
+            {
+                key = (std::log(1 - generator.nextDouble()) / weight);
+            }
+            else
+            {
+                key = -std::numeric_limits<double>::infinity();
+            }
+            if (numChosen > _keys.size())
+            {
+                _keys.push_back(KeyedIndex(key, ii));
+                std::push_heap(_keys.begin(), _keys.end(), keyOrder);
+            }
+            else if (_keys.front().first < key)
+            {
+                std::pop_heap(_keys.begin(), _keys.end(), keyOrder);
+                _keys.back() = KeyedIndex(key, ii);
+                std::push_heap(_keys.begin(), _keys.end(), keyOrder);
+            }
+        }
+        // The heap yields the smallest key first, which is the last object that would have been
+        // chosen by repeated spins.
+        result.resize(numChosen);
+        for (size_t ii = numChosen; 0 < ii; --ii)
+        {
+            result[ii - 1] = _keys.front().second;
+            std::pop_heap(_keys.begin(), _keys.end(), keyOrder);
+            _keys.pop_back();
+        }
+    }
+} // RouletteWheel::pickWithoutReplacement
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
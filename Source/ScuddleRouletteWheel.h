@@ -0,0 +1,176 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleRouletteWheel.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for RouletteWheel objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_RouletteWheel_H_))
+# define Scuddle_RouletteWheel_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+
+# include <utility>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for RouletteWheel objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief A fitness-proportional selector over a set of weights.
+     
+     The running totals of the weights are kept, using compensated summation so that they remain
+     accurate for very large sets, and each spin of the wheel is a binary search of the totals.
+     Objects with a weight of zero are never chosen by a spin. */
+    class RouletteWheel
+    {
+    public :
+        
+        /*! @brief The constructor. */
+        RouletteWheel(void);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~RouletteWheel(void);
+        
+        /*! @brief Set up the wheel for a set of weights.
+         @param weights The weights of the objects; negative weights are treated as zero.
+         @param numWeights The number of weights. */
+        void
+        build(const realType * weights,
+              const size_t     numWeights);
+        
+        /*! @brief Return the sum of the weights.
+         @returns The sum of the weights. */
+        double
+        getTotal(void)
+        const
+        {
+            return _total;
+        } // getTotal
+        
+        /*! @brief Choose an object, with a probability proportional to its weight.
+         @param generator The random number generator to use.
+         @returns The index of the chosen object. */
+        size_t
+        pick(RandomGenerator & generator)
+        const;
+        
+        /*! @brief Choose a number of objects using stochastic universal sampling.
+         
+         A single spin places equally spaced pointers around the wheel, so the number of times
+         that an object is chosen never differs from its expected value by more than one. The
+         chosen objects are in ascending order and may be repeated.
+         @param count The number of objects to choose.
+         @param generator The random number generator to use.
+         @param result The indices of the chosen objects. */
+        void
+        pickUniversal(const size_t          count,
+                      RandomGenerator &     generator,
+                      std::vector<size_t> & result)
+        const;
+        
+        /*! @brief Choose a number of distinct objects, with probabilities proportional to their
+         weights.
+         
+         Each object is given a random key based on its weight and the objects with the largest
+         keys are chosen, which is equivalent to repeatedly spinning the wheel and discarding
+         objects that have already been chosen. The chosen objects are in the order in which they
+         would have been chosen by repeated spins. If there are not enough objects with a
+         non-zero weight, objects with a weight of zero make up the difference.
+         @param count The number of objects to choose.
+         @param generator The random number generator to use.
+         @param result The indices of the chosen objects. */
+        void
+        pickWithoutReplacement(const size_t          count,
+                               RandomGenerator &     generator,
+                               std::vector<size_t> & result);
+        
+        /*! @brief Return the number of objects on the wheel.
+         @returns The number of objects on the wheel. */
+        size_t
+        size(void)
+        const
+        {
+            return _weights.size();
+        } // size
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The key for an object, paired with the index of the object. */
+        typedef std::pair<double, size_t> KeyedIndex;
+        
+        /*! @brief Return the object corresponding to a position on the wheel.
+         @param position The position on the wheel, from @c 0 up to the sum of the weights.
+         @returns The index of the corresponding object. */
+        size_t
+        find(const double position)
+        const;
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The heap of keys used to choose objects without replacement, which is kept
+         between choices so that its storage is reused. */
+        std::vector<KeyedIndex> _keys;
+        
+        /*! @brief The running totals of the weights. */
+        std::vector<double> _cumulative;
+        
+        /*! @brief The weights of the objects. */
+        std::vector<realType> _weights;
+        
+        /*! @brief The sum of the weights. */
+        double _total;
+        
+    }; // RouletteWheel
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_RouletteWheel_H_) */
@@ -38,6 +38,10 @@
 
 #include "ScuddleSkeleton.h"
 
+#include "ScuddleFitnessCache.h"
+
+#include <type_traits>
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -59,127 +63,60 @@ using namespace Scuddle;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
-/*! @brief The initial fitness coefficient for Bartenieff contralateral configurations. */
-static const realType kInitialBartenieffContralateral = static_cast<realType>(1.3);
-
-/*! @brief The initial fitness coefficient for Bartenieff distal configurations. */
-static const realType kInitialBartenieffDistal = static_cast<realType>(0.4);
-
-/*! @brief The initial fitness coefficient for Bartenieff homolateral configurations. */
-static const realType kInitialBartenieffHomolateral = static_cast<realType>(0.5);
-
-/*! @brief The initial fitness coefficient for Bartenieff homologous configurations. */
-static const realType kInitialBartenieffHomologous = static_cast<realType>(0.4);
-
-/*! @brief The initial fitness coefficient for Bartenieff medial configurations. */
-static const realType kInitialBartenieffMedial = static_cast<realType>(0.7);
-
-/*! @brief The initial fitness coefficient for high Effort configurations. */
-static const realType kInitialEffortHigh = static_cast<realType>(1.4);
-
-/*! @brief The initial fitness coefficient for low Effort configurations. */
-static const realType kInitialEffortLow = static_cast<realType>(0.6);
-
-/*! @brief The initial fitness coefficient for medium Effort configurations. */
-static const realType kInitialEffortMedium = static_cast<realType>(1.2);
-
-/*! @brief The initial fitness coefficient for unextended leg configurations. */
-static const realType kInitialUnextendedLegs = static_cast<realType>(0.3);
-
-/*! @brief The maximum fitness coefficient for Bartenieff contralateral configurations. */
-static const realType kMaximumBartenieffContralateral = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for Bartenieff distal configurations. */
-static const realType kMaximumBartenieffDistal = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for Bartenieff homolateral configurations. */
-static const realType kMaximumBartenieffHomolateral = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for Bartenieff homologous configurations. */
-static const realType kMaximumBartenieffHomologous = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for Bartenieff medial configurations. */
-static const realType kMaximumBartenieffMedial = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for high Effort configurations. */
-static const realType kMaximumEffortHigh = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for low Effort configurations. */
-static const realType kMaximumEffortLow = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for medium Effort configurations. */
-static const realType kMaximumEffortMedium = static_cast<realType>(10);
-
-/*! @brief The maximum fitness coefficient for unextended leg configurations. */
-static const realType kMaximumUnextendedLegs = static_cast<realType>(10);
-
-/*! @brief The minimum fitness coefficient for Bartenieff contralateral configurations. */
-static const realType kMinimumBartenieffContralateral = static_cast<realType>(0);
-
-/*! @brief The minimum fitness coefficient for Bartenieff distal configurations. */
-static const realType kMinimumBartenieffDistal = static_cast<realType>(0);
-
-/*! @brief The minimum fitness coefficient for Bartenieff homolateral configurations. */
-static const realType kMinimumBartenieffHomolateral = static_cast<realType>(0);
-
-/*! @brief The minimum fitness coefficient for Bartenieff homologous configurations. */
-static const realType kMinimumBartenieffHomologous = static_cast<realType>(0);
-
-/*! @brief The minimum fitness coefficient for Bartenieff medial configurations. */
-static const realType kMinimumBartenieffMedial = static_cast<realType>(0);
-
-/*! @brief The minimum fitness coefficient for high Effort configurations. */
-static const realType kMinimumEffortHigh = static_cast<realType>(0);
-
-/*! @brief The minimum fitness coefficient for low Effort configurations. */
-static const realType kMinimumEffortLow = static_cast<realType>(0);
-
-/*! @brief The minimum fitness coefficient for medium Effort configurations. */
-static const realType kMinimumEffortMedium = static_cast<realType>(0);
+/*! @brief The arguments to MapAngleToQuadrant for one angle. */
+struct QuadrantMapping
+{
+    /*! @brief The upper bound of the first range, in degrees. */
+    realType _firstAngle;
+    
+    /*! @brief The quadrant for the first range. */
+    int _firstQuadrant;
+    
+    /*! @brief The upper bound of the second range, in degrees. */
+    realType _secondAngle;
+    
+    /*! @brief The quadrant for the second range. */
+    int _secondQuadrant;
+    
+    /*! @brief The upper bound of the third range, in degrees. */
+    realType _thirdAngle;
+    
+    /*! @brief The quadrant for the third range. */
+    int _thirdQuadrant;
+    
+    /*! @brief The quadrant for the remaining range. */
+    int _fourthQuadrant;
+    
+}; // QuadrantMapping
 
-/*! @brief The minimum fitness coefficient for unextended leg configurations. */
-static const realType kMinimumUnextendedLegs = static_cast<realType>(0);
+// Populations of Skeleton objects are copied and moved around as plain storage.
+static_assert(std::is_trivially_copyable<Skeleton>::value,
+              "Skeleton objects must be trivially copyable");
 
-/*! @brief The number of fixed attributes that can be swapped. */
-static const size_t kNumFixedAttributes = 5;
+/*! @brief The quadrant mapping for each angle, in AngleIndices order. */
+static const QuadrantMapping kQuadrantMappings[Skeleton::kNumCalculatedAngles] =
+{
+    { 90, 4, 180, 1, 270, 2, 1 }, // kLeftHipToKnee
+    { 45, 4, 90, 1, 135, 2, 1 }, // kLeftKneeToFoot
+    { 90, 1, 180, 4, 270, 1, 2 }, // kRightHipToKnee
+    { 45, 1, 90, 4, 135, 1, 2 }, // kRightKneeToFoot
+    { 90, 1, 180, 2, 270, 1, 4 }, // kLeftShoulderToElbow
+    { 45, 1, 90, 2, 135, 1, 4 }, // kLeftElbowToWrist
+    { 90, 2, 180, 1, 270, 4, 1 }, // kRightShoulderToElbow
+    { 45, 2, 90, 1, 135, 4, 1 } // kRightElbowToWrist
+};
+
+/*! @brief The starting point for the hashes of the attributes ('Skeleton'). */
+static const uint64_t kHashSeed = 0x536B656C65746F6E;
+
+/*! @brief The dirty bits when every angle has changed. */
+static const uint8_t kAllAnglesDirty = static_cast<uint8_t>((1 << Skeleton::kNumCalculatedAngles) -
+                                                             1);
 
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
 
-#if defined(__APPLE__)
-# pragma mark Class variables
-#endif // defined(__APPLE__)
-
-ConstrainedRealValue Skeleton::bartenieffContralateral(kMinimumBartenieffContralateral,
-                                                       kMaximumBartenieffContralateral,
-                                                       kInitialBartenieffContralateral);
-
-ConstrainedRealValue Skeleton::bartenieffDistal(kMinimumBartenieffDistal, kMaximumBartenieffDistal,
-                                                kInitialBartenieffDistal);
-
-ConstrainedRealValue Skeleton::bartenieffHomolateral(kMinimumBartenieffHomolateral,
-                                                     kMaximumBartenieffHomolateral,
-                                                     kInitialBartenieffHomolateral);
-
-ConstrainedRealValue Skeleton::bartenieffHomologous(kMinimumBartenieffHomologous,
-                                                    kMaximumBartenieffHomologous,
-                                                    kInitialBartenieffHomologous);
-
-ConstrainedRealValue Skeleton::bartenieffMedial(kMinimumBartenieffMedial, kMaximumBartenieffMedial,
-                                                kInitialBartenieffMedial);
-
-ConstrainedRealValue Skeleton::effortHigh(kMinimumEffortHigh, kMaximumEffortHigh,
-                                          kInitialEffortHigh);
-
-ConstrainedRealValue Skeleton::effortLow(kMinimumEffortLow, kMaximumEffortLow, kInitialEffortLow);
-
-ConstrainedRealValue Skeleton::effortMedium(kMinimumEffortMedium, kMaximumEffortMedium,
-                                            kInitialEffortMedium);
-
-ConstrainedRealValue Skeleton::unextendedLegs(kMinimumUnextendedLegs, kMaximumUnextendedLegs,
-                                              kInitialUnextendedLegs);
-
 #if defined(__APPLE__)
 # pragma mark Local functions
 #endif // defined(__APPLE__)
@@ -195,24 +132,15 @@ ConstrainedRealValue Skeleton::unextendedLegs(kMinimumUnextendedLegs, kMaximumUn
 Skeleton::Skeleton(void) :
     _marked(false)
 {
-    setAttributes(kNumCalculatedAngles);
+    setAttributes(GetThreadRandomGenerator());
 } // Skeleton::Skeleton
 
-Skeleton::Skeleton(const Skeleton & other) :
-    _flow(other._flow), _height(other._height), _space(other._space), _time(other._time),
-    _weight(other._weight), _marked(false)
+Skeleton::Skeleton(RandomGenerator & generator) :
+    _marked(false)
 {
-    for (size_t ii = 0, imax = other._angles.size(); imax > ii; ++ii)
-    {
-        _angles.push_back(other._angles[ii]);
-        _quadrants.push_back(other._quadrants[ii]);
-    }
+    setAttributes(generator);
 } // Skeleton::Skeleton
 
-Skeleton::~Skeleton(void)
-{
-} // Skeleton::~Skeleton
-
 #if defined(__APPLE__)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
@@ -220,39 +148,50 @@ Skeleton::~Skeleton(void)
 void
 Skeleton::determineQuadrants(void)
 {
-    // Calculate the quadrants:
-    _quadrants[kLeftShoulderToElbow] = MapAngleToQuadrant(_angles[kLeftShoulderToElbow], 90, 1,
-                                                          180, 2, 270, 1, 4);
-    _quadrants[kLeftShoulderToElbow] = MapAngleToQuadrant(_angles[kLeftShoulderToElbow], 90, 1, 180,
-                                                          2, 270, 1, 4);
-    _quadrants[kRightShoulderToElbow] = MapAngleToQuadrant(_angles[kRightShoulderToElbow], 90, 2,
-                                                           180, 1, 270, 4, 1);
-    _quadrants[kLeftElbowToWrist] = MapAngleToQuadrant(_angles[kLeftElbowToWrist], 45, 1, 90, 2,
-                                                       135, 1, 4);
-    _quadrants[kRightElbowToWrist] = MapAngleToQuadrant(_angles[kRightElbowToWrist], 45, 2, 90, 1,
-                                                        135, 4, 1);
-    _quadrants[kLeftHipToKnee] = MapAngleToQuadrant(_angles[kLeftHipToKnee], 90, 4, 180, 1, 270, 2,
-                                                    1);
-    _quadrants[kRightHipToKnee] = MapAngleToQuadrant(_angles[kRightHipToKnee], 90, 1, 180, 4, 270,
-                                                     1, 2);
-    _quadrants[kLeftKneeToFoot] = MapAngleToQuadrant(_angles[kLeftKneeToFoot], 45, 4, 90, 1, 135, 2,
-                                                     1);
-    _quadrants[kRightKneeToFoot] = MapAngleToQuadrant(_angles[kRightKneeToFoot], 45, 1, 90, 4, 135,
-                                                      1, 2);
-    _quadrantScore = 0;
-    for (size_t ii = 0, imax = _quadrants.size(); imax > ii; ++ii)
+    for (size_t ii = 0; kNumCalculatedAngles > ii; ++ii)
     {
-        _quadrantScore += _quadrants[ii];
+        if (_dirtyAngles & (1 << ii))
+        {
+            const QuadrantMapping & mapping = kQuadrantMappings[ii];
+            int                     newQuadrant = MapAngleToQuadrant(_angles[ii],
+                                                                     mapping._firstAngle,
+                                                                     mapping._firstQuadrant,
+                                                                     mapping._secondAngle,
+                                                                     mapping._secondQuadrant,
+                                                                     mapping._thirdAngle,
+                                                                     mapping._thirdQuadrant,
+                                                                     mapping._fourthQuadrant);
+            
+            _quadrantScore += (newQuadrant - _quadrants[ii]);
+            _quadrants[ii] = newQuadrant;
+        }
     }
 } // Skeleton::determineQuadrants
 
+realType
+Skeleton::getAngle(const size_t index)
+const
+{
+    realType result;
+    
+    if (kNumCalculatedAngles > index)
+    {
+        result = _angles[index];
+    }
+    else
+    {
+        result = 0;
+    }
+    return result;
+} // Skeleton::getAngle
+
 realType
 Skeleton::getAngleAsDegrees(const size_t index)
 const
 {
     realType result;
     
-    if (index < _angles.size())
+    if (kNumCalculatedAngles > index)
     {
         result = RadiansToDegrees(_angles[index]);
     }
@@ -269,7 +208,7 @@ const
 {
     realType angle;
     
-    if (index < _angles.size())
+    if (kNumCalculatedAngles > index)
     {
         angle = _angles[index];
     }
@@ -280,17 +219,27 @@ const
     return glm::quat_cast(glm::rotate(glm::mat4(1), angle, glm::vec3(0, 0, 1)));
 } // Skeleton::getAngleAsQuaternion
 
-size_t
-Skeleton::getNumAngles(void)
+uint64_t
+Skeleton::getAttributeHash(void)
 const
 {
-    return _angles.size();
-} // Skeleton::getNumAngles
+    uint64_t result = kHashSeed;
+    
+    for (size_t ii = 0; kNumCalculatedAngles > ii; ++ii)
+    {
+        result = HashCombineReal(result, _angles[ii]);
+    }
+    result = HashCombine(result, _weight);
+    result = HashCombine(result, _space);
+    result = HashCombine(result, _time);
+    result = HashCombine(result, _flow);
+    return HashCombine(result, _height);
+} // Skeleton::getAttributeHash
 
 void
-Skeleton::mutate(void)
+Skeleton::mutate(RandomGenerator & generator)
 {
-    size_t whichAngle = RandUnsignedInRange(_angles.size() - 1);
+    size_t whichAngle = generator.nextUnsigned(kNumCalculatedAngles - 1);
     
     switch (whichAngle)
     {
@@ -298,57 +247,47 @@ Skeleton::mutate(void)
         case kRightShoulderToElbow :
         case kLeftHipToKnee :
         case kRightHipToKnee :
-            _angles[whichAngle] = RandomAngle(360);
+            _angles[whichAngle] = generator.nextAngle(360);
             break;
             
         case kLeftElbowToWrist :
         case kRightElbowToWrist :
         case kLeftKneeToFoot :
         case kRightKneeToFoot :
-            _angles[whichAngle] = RandomAngle(180);
+            _angles[whichAngle] = generator.nextAngle(180);
             break;
             
         default :
             break;
             
     }
+    _dirtyAngles |= static_cast<uint8_t>(1 << whichAngle);
 } // Skeleton::mutate
 
 void
-Skeleton::resetParameters(void)
-{
-    bartenieffContralateral.resetValue();
-    bartenieffDistal.resetValue();
-    bartenieffHomolateral.resetValue();
-    bartenieffHomologous.resetValue();
-    bartenieffMedial.resetValue();
-    effortHigh.resetValue();
-    effortLow.resetValue();
-    effortMedium.resetValue();
-    unextendedLegs.resetValue();
-} // Skeleton::resetParameters
-
-void
-Skeleton::setAttributes(const size_t numAngles)
+Skeleton::setAttributes(RandomGenerator & generator)
 {
-    for (size_t ii = 0; numAngles > ii; ++ii)
-    {
-        _quadrants.push_back(-1);
-    }
-    _angles.resize(numAngles);
-    _angles[kLeftShoulderToElbow] = RandomAngle(360);
-    _angles[kLeftElbowToWrist] = RandomAngle(180);
-    _angles[kRightShoulderToElbow] = RandomAngle(360);
-    _angles[kRightElbowToWrist] = RandomAngle(180);
-    _angles[kLeftHipToKnee] = RandomAngle(360);
-    _angles[kLeftKneeToFoot] = RandomAngle(180);
-    _angles[kRightHipToKnee] = RandomAngle(360);
-    _angles[kRightKneeToFoot] = RandomAngle(180);
-    _flow = ((0.5 <= RandRealInRange(0, 1)) ? kFlowBound : kFlowFree);
-    _space = ((0.5 <= RandRealInRange(0, 1)) ? kSpaceDirect : kSpaceIndirect);
-    _time = ((0.5 <= RandRealInRange(0, 1)) ? kTimeSudden : kTimeSustained);
-    _weight = ((0.5 <= RandRealInRange(0, 1)) ? kWeightStrong : kWeightLight);
-    realType aNumb = RandRealInRange(0, 1);
+    // The quadrants are all determined by the first evaluation.
+    _quadrants.fill(0);
+    _quadrantScore = 0;
+    _dirtyAngles = kAllAnglesDirty;
+    _factors.bartenieffClass = kBartenieffClassNone;
+    _factors.effortClass = kEffortClassLow;
+    _factors.heightClass = kHeightClassNone;
+    _factors.quadrantScore = 0;
+    _angles[kLeftShoulderToElbow] = generator.nextAngle(360);
+    _angles[kLeftElbowToWrist] = generator.nextAngle(180);
+    _angles[kRightShoulderToElbow] = generator.nextAngle(360);
+    _angles[kRightElbowToWrist] = generator.nextAngle(180);
+    _angles[kLeftHipToKnee] = generator.nextAngle(360);
+    _angles[kLeftKneeToFoot] = generator.nextAngle(180);
+    _angles[kRightHipToKnee] = generator.nextAngle(360);
+    _angles[kRightKneeToFoot] = generator.nextAngle(180);
+    _flow = ((0.5 <= generator.nextReal(0, 1)) ? kFlowBound : kFlowFree);
+    _space = ((0.5 <= generator.nextReal(0, 1)) ? kSpaceDirect : kSpaceIndirect);
+    _time = ((0.5 <= generator.nextReal(0, 1)) ? kTimeSudden : kTimeSustained);
+    _weight = ((0.5 <= generator.nextReal(0, 1)) ? kWeightStrong : kWeightLight);
+    realType aNumb = generator.nextReal(0, 1);
     
     if (0.8 <= aNumb)
     {
@@ -372,22 +311,13 @@ Skeleton::setAttributes(const size_t numAngles)
     }
 } // Skeleton::setAttributes
 
-# if defined(USE_FRACTION_FOR_CROSSOVER_)
 void
-Skeleton::swapValues(Skeleton &     other,
-                     const realType fraction)
-# else // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-void
-Skeleton::swapValues(Skeleton &   other,
-                     const size_t numSwap)
-# endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
+Skeleton::swapValues(Skeleton &        other,
+                     const size_t      numSwap,
+                     RandomGenerator & generator)
 {
-    size_t imax = std::min(_angles.size(), other._angles.size());
-    size_t numAttributes = kNumFixedAttributes + imax;
+    size_t numAttributes = kNumAttributes;
     size_t realSwap;
-#if defined(USE_FRACTION_FOR_CROSSOVER_)
-    size_t numSwap = static_cast<size_t>(numAttributes * fraction);
-#endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
     
     if (numAttributes < numSwap)
     {
@@ -397,167 +327,132 @@ Skeleton::swapValues(Skeleton &   other,
     {
         realSwap = numSwap;
     }
-    // Collect a set of indices to swap.
-    std::vector<size_t> indices;
+    // Collect a set of distinct indices to swap.
+    bool   chosen[kNumAttributes] = { false };
+    size_t numChosen = 0;
     
-    for (bool tryAgain = true; tryAgain; )
+    do
     {
-        size_t anIndex = RandUnsignedInRange(numAttributes - 1);
+        size_t anIndex = generator.nextUnsigned(numAttributes - 1);
         
-        tryAgain = false;
-        for (std::vector<size_t>::iterator walker(indices.begin()); indices.end() != walker;
-             ++walker)
-        {
-            if (anIndex == *walker)
-            {
-                tryAgain = true;
-                break;
-            }
-            
-        }
-        if (! tryAgain)
+        if (! chosen[anIndex])
         {
-            indices.push_back(anIndex);
-            if (realSwap > indices.size())
-            {
-                tryAgain = true;
-            }
+            chosen[anIndex] = true;
+            ++numChosen;
         }
     }
-    for (std::vector<size_t>::iterator walker(indices.begin()); indices.end() != walker; ++walker)
+    while (realSwap > numChosen);
+    for (size_t ii = 0; numAttributes > ii; ++ii)
     {
-        size_t anIndex = *walker;
-        
-        switch (anIndex)
+        if (chosen[ii])
         {
-            case 0 :
-                std::swap(_weight, other._weight);
-                break;
-                
-            case 1 :
-                std::swap(_space, other._space);
-                break;
-                
-            case 2 :
-                std::swap(_time, other._time);
-                break;
-                
-            case 3 :
-                std::swap(_flow, other._flow);
-                break;
-                
-            case 4 : // This is (kNumAttributes - 1).
-                std::swap(_height, other._height);
-                break;
-                
-            default :
-                // Angles -
-                anIndex -= kNumFixedAttributes;
-                if (imax > anIndex)
-                {
-                    std::swap(_angles[anIndex], other._angles[anIndex]);
-                }
-                break;
-                
+            size_t anIndex = ii;
+            
+            switch (anIndex)
+            {
+                case 0 :
+                    std::swap(_weight, other._weight);
+                    break;
+                    
+                case 1 :
+                    std::swap(_space, other._space);
+                    break;
+                    
+                case 2 :
+                    std::swap(_time, other._time);
+                    break;
+                    
+                case 3 :
+                    std::swap(_flow, other._flow);
+                    break;
+                    
+                case 4 : // This is (kNumFixedAttributes - 1).
+                    std::swap(_height, other._height);
+                    break;
+                    
+                default :
+                    // Angles -
+                    anIndex -= kNumFixedAttributes;
+                    if (_angles[anIndex] != other._angles[anIndex])
+                    {
+                        std::swap(_angles[anIndex], other._angles[anIndex]);
+                        _dirtyAngles |= static_cast<uint8_t>(1 << anIndex);
+                        other._dirtyAngles |= static_cast<uint8_t>(1 << anIndex);
+                    }
+                    break;
+                    
+            }
         }
     }
 } // Skeleton::swapValues
 
-void
-Skeleton::updateFitness(void)
+bool
+Skeleton::updateFitness(const FitnessCoefficients & coefficients)
 {
-    realType critAngle = DegreesToRadians(30);
-    realType bartenieffFactor;
-    realType effortFactor;
-    realType heightFactor;
+    const FitnessTables & tables = GetFitnessTables();
+    bool                  evaluated = (0 != _dirtyAngles);
     
-    determineQuadrants();
-    if ((8 == _quadrantScore) &&
-        ((_quadrants[kLeftShoulderToElbow] == _quadrants[kLeftElbowToWrist]) &&
-         (_quadrants[kRightShoulderToElbow] == _quadrants[kRightElbowToWrist]) &&
-         (_quadrants[kLeftHipToKnee] == _quadrants[kLeftKneeToFoot]) &&
-         (_quadrants[kRightHipToKnee] == _quadrants[kRightKneeToFoot])))
-    {
-        // Distal
-        bartenieffFactor = bartenieffDistal.getValue();
-    }
-    else if ((12 == _quadrantScore) &&
-             ((_quadrants[kLeftShoulderToElbow] == _quadrants[kLeftElbowToWrist]) &&
-              (_quadrants[kRightShoulderToElbow] == _quadrants[kRightElbowToWrist]) &&
-              (_quadrants[kLeftHipToKnee] == _quadrants[kLeftKneeToFoot]) &&
-              (_quadrants[kRightHipToKnee] == _quadrants[kRightKneeToFoot])))
+    // Only the angles determine the Bartenieff class, so it is kept until one of them changes.
+    if (evaluated)
     {
-        // Medial
-        bartenieffFactor = bartenieffMedial.getValue();
-    }
-    else if ((((std::abs(_angles[kLeftShoulderToElbow] - _angles[kLeftHipToKnee]) > critAngle) &&
-               (std::abs(_angles[kLeftElbowToWrist] - _angles[kLeftKneeToFoot]) > critAngle))) ||
-             (((std::abs(_angles[kRightShoulderToElbow] - _angles[kRightHipToKnee]) > critAngle) &&
-               (std::abs(_angles[kRightElbowToWrist] - _angles[kRightKneeToFoot]) > critAngle))))
-    {
-        // Homolateral
-        bartenieffFactor = bartenieffHomolateral.getValue();
-    }
-    else if ((((std::abs(_angles[kLeftShoulderToElbow] - _angles[kRightHipToKnee]) > critAngle) &&
-               (std::abs(_angles[kLeftElbowToWrist] - _angles[kRightKneeToFoot]) > critAngle))) ||
-             (((std::abs(_angles[kRightShoulderToElbow] - _angles[kLeftHipToKnee]) > critAngle) &&
-               (std::abs(_angles[kRightElbowToWrist] - _angles[kLeftKneeToFoot]) > critAngle))))
-    {
-        // Contralateral
-        bartenieffFactor = bartenieffContralateral.getValue();
-    }
-    else if (((_quadrants[kLeftShoulderToElbow] == _quadrants[kRightShoulderToElbow]) &&
-              (_quadrants[kLeftElbowToWrist] == _quadrants[kRightElbowToWrist])) ||
-             ((_quadrants[kLeftHipToKnee] == _quadrants[kRightHipToKnee]) &&
-              (_quadrants[kLeftKneeToFoot] == _quadrants[kRightKneeToFoot])))
-    {
-        // Homologous
-        bartenieffFactor = bartenieffHomologous.getValue();
-    }
-    else
-    {
-        bartenieffFactor = 0.0;
+        realType critAngle = DegreesToRadians(30);
+        size_t   signature = 0;
+        
+        determineQuadrants();
+        for (size_t ii = 0; kNumCalculatedAngles > ii; ++ii)
+        {
+            signature |= QuadrantSignatureBits(ii, _quadrants[ii]);
+        }
+        _factors.bartenieffClass = tables.bartenieffClasses[signature];
+        // The angles decide the configurations that the quadrants alone cannot.
+        if ((kBartenieffClassDistal != _factors.bartenieffClass) &&
+            (kBartenieffClassMedial != _factors.bartenieffClass))
+        {
+            if ((((std::abs(_angles[kLeftShoulderToElbow] - _angles[kLeftHipToKnee]) >
+                   critAngle) &&
+                  (std::abs(_angles[kLeftElbowToWrist] - _angles[kLeftKneeToFoot]) >
+                   critAngle))) ||
+                (((std::abs(_angles[kRightShoulderToElbow] - _angles[kRightHipToKnee]) >
+                   critAngle) &&
+                  (std::abs(_angles[kRightElbowToWrist] - _angles[kRightKneeToFoot]) >
+                   critAngle))))
+            {
+                // Homolateral
+                _factors.bartenieffClass = kBartenieffClassHomolateral;
+            }
+            else if ((((std::abs(_angles[kLeftShoulderToElbow] - _angles[kRightHipToKnee]) >
+                        critAngle) &&
+                       (std::abs(_angles[kLeftElbowToWrist] - _angles[kRightKneeToFoot]) >
+                        critAngle))) ||
+                     (((std::abs(_angles[kRightShoulderToElbow] - _angles[kLeftHipToKnee]) >
+                        critAngle) &&
+                       (std::abs(_angles[kRightElbowToWrist] - _angles[kLeftKneeToFoot]) >
+                        critAngle))))
+            {
+                // Contralateral
+                _factors.bartenieffClass = kBartenieffClassContralateral;
+            }
+        }
+        _dirtyAngles = 0;
     }
+    // The other factors are single lookups on the fixed attributes, which are not tracked.
     // Laban
-    if (((kWeightLight == _weight) && (kSpaceIndirect == _space) && (kTimeSustained == _time) &&
-         (kFlowFree == _flow)) || ((kWeightStrong == _weight) && (kSpaceDirect == _space) &&
-                                   (kTimeSudden == _time) && (kFlowBound == _flow)))
-    {
-        effortFactor = effortLow.getValue();
-    }
-    else if ((ReallyClose(MapWeightToReal(_weight), MapSpaceToReal(_space)) &&
-              ReallyClose(MapTimeToReal(_time), MapFlowToReal(_flow))) ||
-             (ReallyClose(MapWeightToReal(_weight), MapTimeToReal(_time)) &&
-              ReallyClose(MapSpaceToReal(_space), MapFlowToReal(_flow))) ||
-             (ReallyClose(MapWeightToReal(_weight), MapFlowToReal(_flow)) &&
-              ReallyClose(MapSpaceToReal(_space), MapTimeToReal(_time))))
-    {
-        effortFactor = effortMedium.getValue();
-    }
-    else
-    {
-        effortFactor = effortHigh.getValue();
-    }
+    size_t effort = EffortCode(_weight, _space, _time, _flow);
+    
+    _factors.effortClass = tables.effortClasses[effort];
     // Height
-    if ((kHeightLow == _height) || (kHeightMiddle == _height) || (kHeightHigh == _height))
-    {
-        // Make another variable so can track which height is picked
-        _quadrantScore = _quadrantScore + 1;
-    }
-    else
-    {
-        _quadrantScore = _quadrantScore + 3;
-    }
-    if ((kHeightMidLow == _height) || (kHeightMiddle == _height) || (kHeightMidHigh == _height))
+    if (tables.bentLegs[_height])
     {
         // No leg is extended - cannot jump without legs in a crouch!
-        heightFactor = unextendedLegs.getValue();
+        _factors.heightClass = kHeightClassUnextendedLegs;
     }
     else
     {
-        heightFactor = 0.0;
+        _factors.heightClass = kHeightClassNone;
     }
-    _accumulatedScore = ((bartenieffFactor + effortFactor + heightFactor) * _quadrantScore);
+    _factors.quadrantScore = static_cast<uint8_t>(_quadrantScore + tables.heightScores[_height]);
+    rescoreFitness(coefficients);
+    return evaluated;
 } // Skeleton::updateFitness
 
 #if defined(__APPLE__)
@@ -40,6 +40,9 @@
 # define Scuddle_Skeleton_H_ /* Header guard */
 
 # include "ScuddleCommon.h"
+# include "ScuddleFitnessTables.h"
+
+# include <array>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -72,17 +75,29 @@ namespace Scuddle
     {
     public :
         
-        /*! @brief The constructor. */
+        /*! @brief The constructor.
+         
+         The attributes are set using the random number generator for the calling thread. */
         Skeleton(void);
         
+        /*! @brief The constructor.
+         @param generator The random number generator used to set the attributes. */
+        explicit
+        Skeleton(RandomGenerator & generator);
+        
         /*! @brief The copy constructor.
+         
+         A Skeleton holds all of its values inline, so that copying it is a plain copy of its
+         storage, including the mark.
          @param other The Skeleton to be copied. */
-        explicit
-        Skeleton(const Skeleton & other);
+        Skeleton(const Skeleton & other) = default;
+        
+        /*! @brief The move constructor.
+         @param other The Skeleton to be moved. */
+        Skeleton(Skeleton && other) = default;
         
         /*! @brief The destructor. */
-        virtual
-        ~Skeleton(void);
+        ~Skeleton(void) = default;
         
         /*! @brief Unmark the object. */
         void
@@ -91,6 +106,13 @@ namespace Scuddle
             _marked = false;
         } // clearMark
         
+        /*! @brief Return a specific angle (in radians).
+         @param index The index of the angle to be returned.
+         @returns The specified angle, in radians. */
+        realType
+        getAngle(const size_t index)
+        const;
+        
         /*! @brief Return a specific angle (in degrees).
          @param index The index of the angle to be returned.
          @returns The specified angle, in degrees. */
@@ -105,6 +127,21 @@ namespace Scuddle
         getAngleAsQuaternion(const size_t index)
         const;
         
+        /*! @brief Return a hash of the attributes that determine the fitness value.
+         @returns A hash of the attributes that determine the fitness value. */
+        uint64_t
+        getAttributeHash(void)
+        const;
+        
+        /*! @brief Return the factors found by the last evaluation.
+         @returns The factors found by the last evaluation. */
+        const FitnessFactors &
+        getFitnessFactors(void)
+        const
+        {
+            return _factors;
+        } // getFitnessFactors
+        
         /*! @brief Return the calculated fitness score.
          @returns The calculated fitness score. */
         realType
@@ -136,7 +173,10 @@ namespace Scuddle
          @returns The number of angles. */
         size_t
         getNumAngles(void)
-        const;
+        const
+        {
+            return kNumCalculatedAngles;
+        } // getNumAngles
         
         /*! @brief Return the Space Quality.
          @returns The Space Quality value. */
@@ -174,13 +214,43 @@ namespace Scuddle
             return _marked;
         } // isMarked
         
-        /*! @brief Mutate a value of the object. */
+        /*! @brief Mutate a value of the object.
+         @param generator The random number generator to use. */
         void
-        mutate(void);
-        
-        /*! @brief Reset the fitness parameters to their initial settings. */
-        static void
-        resetParameters(void);
+        mutate(RandomGenerator & generator);
+        
+        /*! @brief The assignment operator.
+         @param other The Skeleton to be copied.
+         @returns The updated object. */
+        Skeleton &
+        operator =(const Skeleton & other) = default;
+        
+        /*! @brief The move assignment operator.
+         @param other The Skeleton to be moved.
+         @returns The updated object. */
+        Skeleton &
+        operator =(Skeleton && other) = default;
+        
+        /*! @brief Recalculate the fitness value from the factors found by the last evaluation.
+         
+         The attributes must not have changed since the last evaluation.
+         @param coefficients The fitness coefficients to be applied. */
+        void
+        rescoreFitness(const FitnessCoefficients & coefficients)
+        {
+            _accumulatedScore = ScoreFitnessFactors(coefficients, _factors);
+        } // rescoreFitness
+        
+        /*! @brief Set the factors to those found by a previous evaluation of the same
+         attributes.
+         
+         The fitness value is not changed; use rescoreFitness to apply the fitness coefficients.
+         @param factors The factors for the current attributes. */
+        void
+        setFitnessFactors(const FitnessFactors & factors)
+        {
+            _factors = factors;
+        } // setFitnessFactors
         
         /*! @brief Mark the object. */
         void
@@ -189,44 +259,50 @@ namespace Scuddle
             _marked = true;
         } // setMark
         
-# if defined(USE_FRACTION_FOR_CROSSOVER_)
-        /*! @brief Choose a set of values and swap with another Body.
-         @param other The other Body to be modified.
-         @param fraction The fraction of the values to be exchanged. */
-        void
-        swapValues(Skeleton &     other,
-                   const realType fraction);
-# else // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-        /*! @brief Choose a set of values and swap with another Body.
-         @param other The other Body to be modified.
-         @param numSwap The number of values to be exchanged. */
-        void
-        swapValues(Skeleton &   other,
-                   const size_t numSwap);
-# endif // ! defined(USE_FRACTION_FOR_CROSSOVER_)
-        
-        /*! @brief Determine the fitness value for this object. */
+        /*! @brief Choose a set of values and swap with another Skeleton.
+         @param other The other Skeleton to be modified.
+         @param numSwap The number of values to be exchanged.
+         @param generator The random number generator to use. */
         void
-        updateFitness(void);
+        swapValues(Skeleton &        other,
+                   const size_t      numSwap,
+                   RandomGenerator & generator);
+        
+        /*! @brief Determine the fitness value for this object.
+         
+         Only the angles that have changed since the last evaluation are mapped to their
+         quadrants again; if none have changed, the stored Bartenieff class is used.
+         @param coefficients The fitness coefficients to be applied.
+         @returns @c true if the angles were evaluated and @c false if the stored Bartenieff class
+         was used. */
+        bool
+        updateFitness(const FitnessCoefficients & coefficients);
         
     protected :
     
     private :
         
-        /*! @brief Determine the quadrants for the various angles. */
+        /*! @brief Determine the quadrants for the angles that have changed since the last
+         evaluation, adjusting the quadrant score to match. */
         void
         determineQuadrants(void);
         
         /*! @brief Set the attributes to random values.
-         @param numAngles The number of angles to be set up. */
+         @param generator The random number generator to use. */
         void
-        setAttributes(const size_t numAngles);
+        setAttributes(RandomGenerator & generator);
         
     public :
         
         /*! @brief The number of angles in each Skeleton. */
         static const size_t kNumCalculatedAngles = 8;
         
+        /*! @brief The number of attributes in each Skeleton that are not angles. */
+        static const size_t kNumFixedAttributes = 5;
+        
+        /*! @brief The number of attributes that can be swapped. */
+        static const size_t kNumAttributes = (kNumFixedAttributes + kNumCalculatedAngles);
+        
         /*! @brief The 'meaning' of the individual angles within the Skeleton object. */
         enum AngleIndices
         {
@@ -256,47 +332,20 @@ namespace Scuddle
             
         }; // AngleIndices
         
-        /*! @brief The fitness coefficient for Bartenieff contralateral configurations. */
-        static ConstrainedRealValue bartenieffContralateral;
-
-        /*! @brief The fitness coefficient for Bartenieff distal configurations. */
-        static ConstrainedRealValue bartenieffDistal;
-        
-        /*! @brief The fitness coefficient for Bartenieff homolateral configurations. */
-        static ConstrainedRealValue bartenieffHomolateral;
-        
-        /*! @brief The fitness coefficient for Bartenieff homologous configurations. */
-        static ConstrainedRealValue bartenieffHomologous;
-        
-        /*! @brief The fitness coefficient for Bartenieff medial configurations. */
-        static ConstrainedRealValue bartenieffMedial;
-        
-        /*! @brief The fitness coefficient for high Effort configurations. */
-        static ConstrainedRealValue effortHigh;
-        
-        /*! @brief The fitness coefficient for low Effort configurations. */
-        static ConstrainedRealValue effortLow;
-
-        /*! @brief The fitness coefficient for medium Effort configurations. */
-        static ConstrainedRealValue effortMedium;
-        
-        /*! @brief The fitness coefficient for unextended leg configurations. */
-        static ConstrainedRealValue unextendedLegs;
-        
     protected :
     
     private :
         
         /*! @brief The angles (in radians) to be worked with. */
-        std::vector<realType> _angles;
+        std::array<realType, kNumCalculatedAngles> _angles;
         
         /*! @brief The quadrants corresponding to the angles being worked with. */
-        std::vector<int> _quadrants;
+        std::array<int, kNumCalculatedAngles> _quadrants;
         
         /*! @brief The calculated fitness score. */
         realType _accumulatedScore;
         
-        /*! @brief The score contribution from the quadrants. */
+        /*! @brief The sum of the quadrants. */
         int _quadrantScore;
         
         /*! @brief The Flow Effort Quality value. */
@@ -314,6 +363,12 @@ namespace Scuddle
         /*! @brief The Weight Effort Quality value. */
         WeightQuality _weight;
         
+        /*! @brief One bit for each angle that has changed since the last evaluation. */
+        uint8_t _dirtyAngles;
+        
+        /*! @brief The factors found by the last evaluation. */
+        FitnessFactors _factors;
+        
         /*! @brief @c true if the object has been marked and @c false otherwise. */
         bool _marked;
         
@@ -0,0 +1,342 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleTrace.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The function definitions for recording trace events.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleTrace.h"
+
+#include <atomic>
+#include <iomanip>
+#include <set>
+#include <thread>
+#include <vector>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The function definitions for recording trace events. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of events that each thread can hold before they are written out. */
+static const size_t kTraceBufferCapacity = (static_cast<size_t>(1) << 14);
+
+/*! @brief A completed span of work. */
+struct TraceEvent
+{
+    /*! @brief The name of the span. */
+    const char * _name;
+    
+    /*! @brief The time at which the work started, in nanoseconds since the clock's epoch. */
+    int64_t _startTime;
+    
+    /*! @brief The duration of the work, in nanoseconds. */
+    int64_t _duration;
+    
+    /*! @brief The identifier of the engine that did the work. */
+    uint32_t _sourceId;
+    
+    /*! @brief The identifier of the thread that did the work. */
+    uint32_t _threadId;
+    
+}; // TraceEvent
+
+/*! @brief A buffer of events, written by a single thread and read by WriteTraceEvents.
+ 
+ The events form a ring; the writer only advances the count of events written and the reader
+ only advances the count of events read, so neither has to lock. When a thread exits, its buffer
+ is released for use by another thread. Buffers are never freed, so that a reader can always
+ walk the list. */
+struct TraceBuffer
+{
+    /*! @brief The events. */
+    TraceEvent _events[kTraceBufferCapacity];
+    
+    /*! @brief The number of events that have been written. */
+    std::atomic<uint64_t> _numWritten;
+    
+    /*! @brief The number of events that have been read. */
+    std::atomic<uint64_t> _numRead;
+    
+    /*! @brief @c true if a thread is using the buffer. */
+    std::atomic<bool> _inUse;
+    
+    /*! @brief The next buffer in the list; does not change once the buffer is in the list. */
+    TraceBuffer * _next;
+    
+}; // TraceBuffer
+
+/*! @brief The buffer used by a thread, which is released when the thread exits. */
+struct TraceBufferOwner
+{
+    /*! @brief The buffer used by the thread, or @c nullptr if it has not recorded any events. */
+    TraceBuffer * _buffer;
+    
+    /*! @brief The identifier of the thread, or @c 0 if it has not recorded any events. */
+    uint32_t _threadId;
+    
+    /*! @brief The destructor. */
+    ~TraceBufferOwner(void)
+    {
+        if (_buffer)
+        {
+            _buffer->_inUse.store(false, std::memory_order_release);
+        }
+    } // ~TraceBufferOwner
+    
+}; // TraceBufferOwner
+
+/*! @brief The list of buffers. */
+static std::atomic<TraceBuffer *> lTraceBuffers(nullptr);
+
+/*! @brief The number of events that were discarded because a buffer was full. */
+static std::atomic<uint64_t> lDroppedEvents(0);
+
+/*! @brief The identifier of the next engine. */
+static std::atomic<uint32_t> lNextSourceId(1);
+
+/*! @brief The identifier of the next thread to record an event. */
+static std::atomic<uint32_t> lNextThreadId(1);
+
+/*! @brief @c true if trace events are being recorded. */
+static std::atomic<bool> lTracingEnabled(false);
+
+/*! @brief Set while the events are being written out, so that only one thread reads the buffers
+ at a time. */
+static std::atomic_flag lWritingEvents = ATOMIC_FLAG_INIT;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return a buffer for the calling thread, reusing a released buffer if there is one.
+ @returns A buffer for the calling thread. */
+static TraceBuffer *
+claimTraceBuffer(void)
+{
+    TraceBuffer * result = nullptr;
+    
+    for (TraceBuffer * walker = lTraceBuffers.load(std::memory_order_acquire);
+         walker && (! result); walker = walker->_next)
+    {
+        bool expected = false;
+        
+        if (walker->_inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            result = walker;
+        }
+    }
+    if (! result)
+    {
+        result = new TraceBuffer;
+        result->_numWritten = 0;
+        result->_numRead = 0;
+        result->_inUse = true;
+        result->_next = lTraceBuffers.load(std::memory_order_relaxed);
+        while (! lTraceBuffers.compare_exchange_weak(result->_next, result,
+                                                     std::memory_order_release,
+                                                     std::memory_order_relaxed))
+        {
+        }
+    }
+    return result;
+} // claimTraceBuffer
+
+/*! @brief Write out a time in microseconds, as expected by the trace event format.
+ @param outStream The stream to write to.
+ @param nanoseconds The time, in nanoseconds. */
+static void
+writeMicroseconds(std::ostream & outStream,
+                  const int64_t  nanoseconds)
+{
+    outStream << (nanoseconds / 1000) << "." << std::setw(3) << std::setfill('0') <<
+                (nanoseconds % 1000) << std::setfill(' ');
+} // writeMicroseconds
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+void
+Scuddle::EnableTracing(const bool enabled)
+{
+    lTracingEnabled.store(enabled, std::memory_order_relaxed);
+} // Scuddle::EnableTracing
+
+uint64_t
+Scuddle::GetDroppedTraceEventCount(void)
+{
+    return lDroppedEvents.load(std::memory_order_relaxed);
+} // Scuddle::GetDroppedTraceEventCount
+
+bool
+Scuddle::IsTracingEnabled(void)
+{
+    return lTracingEnabled.load(std::memory_order_relaxed);
+} // Scuddle::IsTracingEnabled
+
+uint32_t
+Scuddle::NewTraceSourceId(void)
+{
+    return lNextSourceId++;
+} // Scuddle::NewTraceSourceId
+
+void
+Scuddle::RecordTraceEvent(const char *                   name,
+                          const uint32_t                 sourceId,
+                          const TraceClock::time_point & startTime,
+                          const TraceClock::time_point & finishTime)
+{
+    static thread_local TraceBufferOwner owner = { nullptr, 0 };
+    TraceBuffer *                        aBuffer = owner._buffer;
+    uint64_t                             numWritten;
+    
+    if (! aBuffer)
+    {
+        aBuffer = claimTraceBuffer();
+        owner._buffer = aBuffer;
+        owner._threadId = lNextThreadId++;
+    }
+    numWritten = aBuffer->_numWritten.load(std::memory_order_relaxed);
+    if ((numWritten - aBuffer->_numRead.load(std::memory_order_acquire)) < kTraceBufferCapacity)
+    {
+        TraceEvent & anEvent = aBuffer->_events[numWritten % kTraceBufferCapacity];
+        
+        anEvent._name = name;
+        anEvent._startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                            startTime.time_since_epoch()).count();
+        anEvent._duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finishTime -
+                                                                             startTime).count();
+        anEvent._sourceId = sourceId;
+        anEvent._threadId = owner._threadId;
+        aBuffer->_numWritten.store(numWritten + 1, std::memory_order_release);
+    }
+    else
+    {
+        lDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+} // Scuddle::RecordTraceEvent
+
+void
+Scuddle::WriteTraceEvents(std::ostream & outStream)
+{
+    std::vector<TraceEvent>                  events;
+    std::set<uint32_t>                       sources;
+    std::set<std::pair<uint32_t, uint32_t> > lanes;
+    const char *                             separator = "";
+    
+    while (lWritingEvents.test_and_set(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+    for (TraceBuffer * walker = lTraceBuffers.load(std::memory_order_acquire); walker;
+         walker = walker->_next)
+    {
+        uint64_t numRead = walker->_numRead.load(std::memory_order_relaxed);
+        uint64_t numWritten = walker->_numWritten.load(std::memory_order_acquire);
+        
+        for (uint64_t ii = numRead; numWritten > ii; ++ii)
+        {
+            events.push_back(walker->_events[ii % kTraceBufferCapacity]);
+        }
+        walker->_numRead.store(numWritten, std::memory_order_release);
+    }
+    lWritingEvents.clear(std::memory_order_release);
+    outStream << "{\"traceEvents\":[";
+    for (std::vector<TraceEvent>::const_iterator walker(events.begin()); events.end() != walker;
+         ++walker)
+    {
+        // The names are identifiers from the engines, so they need no escaping.
+        outStream << separator << "{\"name\":\"" << walker->_name << "\",\"cat\":\"scuddle\"," <<
+                    "\"ph\":\"X\",\"pid\":" << walker->_sourceId << ",\"tid\":" <<
+                    walker->_threadId << ",\"ts\":";
+        writeMicroseconds(outStream, walker->_startTime);
+        outStream << ",\"dur\":";
+        writeMicroseconds(outStream, walker->_duration);
+        outStream << "}";
+        separator = ",\n";
+        sources.insert(walker->_sourceId);
+        lanes.insert(std::make_pair(walker->_sourceId, walker->_threadId));
+    }
+    for (std::set<uint32_t>::const_iterator walker(sources.begin()); sources.end() != walker;
+         ++walker)
+    {
+        outStream << separator << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << *walker <<
+                    ",\"args\":{\"name\":\"Engine " << *walker << "\"}}";
+        separator = ",\n";
+    }
+    for (std::set<std::pair<uint32_t, uint32_t> >::const_iterator walker(lanes.begin());
+         lanes.end() != walker; ++walker)
+    {
+        outStream << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" <<
+                    walker->first << ",\"tid\":" << walker->second <<
+                    ",\"args\":{\"name\":\"Thread " << walker->second << "\"}}";
+        separator = ",\n";
+    }
+    outStream << "],\n\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":" <<
+                GetDroppedTraceEventCount() << "}}" << std::endl;
+} // Scuddle::WriteTraceEvents
@@ -0,0 +1,118 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleTrace.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The function declarations for recording trace events.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_Trace_H_))
+# define Scuddle_Trace_H_ /* Header guard */
+
+# include "ScuddleCommon.h"
+
+# include <chrono>
+# include <cstdint>
+# include <ostream>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The function declarations for recording trace events. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    /*! @brief The clock used to time trace events. */
+    typedef std::chrono::steady_clock TraceClock;
+    
+    /*! @brief Start or stop recording trace events.
+     
+     While disabled, RecordTraceEvent is not called by the engines and recording costs a single
+     flag test per phase.
+     @param enabled @c true if trace events are to be recorded. */
+    void
+    EnableTracing(const bool enabled);
+    
+    /*! @brief Return the number of trace events that were discarded because the buffer of the
+     recording thread was full.
+     @returns The number of trace events that were discarded. */
+    uint64_t
+    GetDroppedTraceEventCount(void);
+    
+    /*! @brief Return @c true if trace events are being recorded.
+     @returns @c true if trace events are being recorded. */
+    bool
+    IsTracingEnabled(void);
+    
+    /*! @brief Return a new identifier for a source of trace events.
+     
+     Each evolution engine has its own identifier, which is used as the process identifier of its
+     events, so that the events of each engine are grouped together by a trace viewer.
+     @returns A new identifier, starting from @c 1. */
+    uint32_t
+    NewTraceSourceId(void);
+    
+    /*! @brief Record a completed span of work.
+     
+     Each thread has its own buffer of events, so recording never locks or waits; if the buffer
+     of the calling thread is full, the event is discarded.
+     @param name The name of the span; must remain valid until the events are written.
+     @param sourceId The identifier of the engine that did the work.
+     @param startTime The time at which the work started.
+     @param finishTime The time at which the work finished. */
+    void
+    RecordTraceEvent(const char *                   name,
+                     const uint32_t                 sourceId,
+                     const TraceClock::time_point & startTime,
+                     const TraceClock::time_point & finishTime);
+    
+    /*! @brief Write out the trace events recorded since the previous call, in the Chrome trace
+     event JSON format.
+     
+     The output can be loaded into chrome://tracing or the Perfetto UI. Each engine appears as a
+     process and each recording thread as a thread. Threads can keep recording while the events
+     are being written; events recorded during the call may be left for the next call.
+     @param outStream The stream to write to. */
+    void
+    WriteTraceEvents(std::ostream & outStream);
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_Trace_H_) */
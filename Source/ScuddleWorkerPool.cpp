@@ -0,0 +1,245 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleWorkerPool.cpp
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class definition for WorkerPool objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "ScuddleWorkerPool.h"
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for WorkerPool objects. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace Scuddle;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of chunks per thread when the chunk size is selected automatically. */
+static const size_t kChunksPerThread = 8;
+
+/*! @brief The granularity of automatically selected chunk sizes, so that threads do not share
+ cache lines of the columns that they write. */
+static const size_t kChunkGranularity = 16;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+WorkerPool::WorkerPool(const size_t numThreads) :
+    _task(nullptr), _nextItem(0), _numItems(0), _chunkSize(1), _activeThreads(0), _jobNumber(0),
+    _stopping(false)
+{
+    size_t totalThreads = numThreads;
+    
+    if (0 == totalThreads)
+    {
+        totalThreads = std::thread::hardware_concurrency();
+    }
+    for (size_t ii = 1; totalThreads > ii; ++ii)
+    {
+        _threads.push_back(std::thread(&WorkerPool::workerLoop, this));
+    }
+} // WorkerPool::WorkerPool
+
+WorkerPool::~WorkerPool(void)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        
+        _stopping = true;
+    }
+    _wakeCondition.notify_all();
+    for (std::vector<std::thread>::iterator walker(_threads.begin()); _threads.end() != walker;
+         ++walker)
+    {
+        walker->join();
+    }
+} // WorkerPool::~WorkerPool
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+WorkerPool::processChunks(void)
+{
+    for ( ; ; )
+    {
+        size_t first = _nextItem.fetch_add(_chunkSize);
+        
+        if (first >= _numItems)
+        {
+            break;
+        }
+        
+        size_t last = ((_numItems - first) > _chunkSize) ? (first + _chunkSize) : _numItems;
+        
+        try
+        {
+            (*_task)(first, last);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            
+            if (! _error)
+            {
+                _error = std::current_exception();
+            }
+        }
+    }
+} // WorkerPool::processChunks
+
+void
+WorkerPool::run(const size_t      numItems,
+                const size_t      chunkSize,
+                const RangeTask & task)
+{
+    size_t actualChunk = chunkSize;
+    
+    if (0 == actualChunk)
+    {
+        actualChunk = (numItems / (getThreadCount() * kChunksPerThread));
+        actualChunk = (((actualChunk + kChunkGranularity - 1) / kChunkGranularity) *
+                       kChunkGranularity);
+        if (0 == actualChunk)
+        {
+            actualChunk = kChunkGranularity;
+        }
+    }
+    if (_threads.empty() || (numItems <= actualChunk))
+    {
+        // Not worth waking the other threads.
+        if (0 < numItems)
+        {
+            task(0, numItems);
+        }
+    }
+    else
+    {
+        std::exception_ptr error;
+        
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            
+            _task = &task;
+            _numItems = numItems;
+            _chunkSize = actualChunk;
+            _nextItem = 0;
+            _activeThreads = _threads.size();
+            _error = nullptr;
+            ++_jobNumber;
+        }
+        _wakeCondition.notify_all();
+        processChunks();
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            
+            while (0 < _activeThreads)
+            {
+                _doneCondition.wait(guard);
+            }
+            _task = nullptr;
+            error = _error;
+            _error = nullptr;
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+} // WorkerPool::run
+
+void
+WorkerPool::workerLoop(void)
+{
+    size_t lastJob = 0;
+    
+    for ( ; ; )
+    {
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            
+            while ((! _stopping) && (lastJob == _jobNumber))
+            {
+                _wakeCondition.wait(guard);
+            }
+            if (_stopping)
+            {
+                break;
+            }
+            lastJob = _jobNumber;
+        }
+        processChunks();
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            
+            if (0 == --_activeThreads)
+            {
+                _doneCondition.notify_one();
+            }
+        }
+    }
+} // WorkerPool::workerLoop
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,181 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       ScuddleWorkerPool.h
+//
+//  Project:    Scuddle
+//
+//  Contains:   The class declaration for WorkerPool objects.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2015 by Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(Scuddle_WorkerPool_H_))
+# define Scuddle_WorkerPool_H_ /* Header guard */
+
+# include "ScuddleDataTypes.h"
+
+# include <atomic>
+# include <condition_variable>
+# include <exception>
+# include <functional>
+# include <mutex>
+# include <thread>
+# include <vector>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for WorkerPool objects. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace Scuddle
+{
+    
+    /*! @brief A set of persistent threads that share the work of processing a range of items.
+     
+     The threads are created once and wait between jobs, so that a job can be run every
+     generation without the cost of creating threads. The range is handed out in chunks, on a
+     first-come first-served basis, so that threads that finish early take on more of the work. */
+    class WorkerPool
+    {
+    public :
+        
+        /*! @brief The work to be done on a range of items.
+         
+         The first argument is the index of the first item in the range and the second argument is
+         the index past the last item in the range. */
+        typedef std::function<void(const size_t, const size_t)> RangeTask;
+        
+        /*! @brief The constructor.
+         @param numThreads The number of threads to use, including the thread that runs each job;
+         @c 0 uses one thread per hardware thread. */
+        explicit
+        WorkerPool(const size_t numThreads);
+        
+        /*! @brief The destructor. */
+        virtual
+        ~WorkerPool(void);
+        
+        /*! @brief Return the number of threads used, including the thread that runs each job.
+         @returns The number of threads used. */
+        size_t
+        getThreadCount(void)
+        const
+        {
+            return (_threads.size() + 1);
+        } // getThreadCount
+        
+        /*! @brief Process a range of items, using all the threads, and wait for completion.
+         
+         The calling thread also processes chunks of the range. If a chunk throws an exception,
+         the remaining chunks are still processed and the first exception is rethrown here.
+         @param numItems The number of items to be processed.
+         @param chunkSize The number of items handed to a thread at a time; @c 0 selects a size
+         based on the number of items and the number of threads.
+         @param task The work to be done on each chunk. */
+        void
+        run(const size_t      numItems,
+            const size_t      chunkSize,
+            const RangeTask & task);
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The copy constructor. Not implemented.
+         @param other The object to be copied. */
+        WorkerPool(const WorkerPool & other);
+        
+        /*! @brief The assignment operator. Not implemented.
+         @param other The object to be copied. */
+        WorkerPool &
+        operator =(const WorkerPool & other);
+        
+        /*! @brief Process chunks of the current job until none are left. */
+        void
+        processChunks(void);
+        
+        /*! @brief The body of each of the threads. */
+        void
+        workerLoop(void);
+        
+    public :
+        
+    protected :
+        
+    private :
+        
+        /*! @brief The threads, not including the thread that runs each job. */
+        std::vector<std::thread> _threads;
+        
+        /*! @brief The lock protecting the job description. */
+        std::mutex _lock;
+        
+        /*! @brief Signalled when a new job is available or the threads are to exit. */
+        std::condition_variable _wakeCondition;
+        
+        /*! @brief Signalled when the last thread has finished with the current job. */
+        std::condition_variable _doneCondition;
+        
+        /*! @brief The first exception thrown by the current job. */
+        std::exception_ptr _error;
+        
+        /*! @brief The work to be done for the current job. */
+        const RangeTask * _task;
+        
+        /*! @brief The index of the next item to be handed out. */
+        std::atomic<size_t> _nextItem;
+        
+        /*! @brief The number of items in the current job. */
+        size_t _numItems;
+        
+        /*! @brief The number of items handed to a thread at a time for the current job. */
+        size_t _chunkSize;
+        
+        /*! @brief The number of threads that have not yet finished with the current job. */
+        size_t _activeThreads;
+        
+        /*! @brief The sequence number of the current job. */
+        size_t _jobNumber;
+        
+        /*! @brief @c true if the threads are to exit. */
+        bool _stopping;
+        
+    }; // WorkerPool
+    
+} // Scuddle
+
+#endif /* ! defined(Scuddle_WorkerPool_H_) */